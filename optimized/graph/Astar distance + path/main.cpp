@@ -5,6 +5,7 @@
 #include <utility>
 #include <algorithm>
 #include <cmath>
+#include <random>
 
 // ------------------- Data structures -------------------
 
@@ -101,6 +102,638 @@ AStarResult astar(int start,
     return result;
 }
 
+// ------------------- CSR graph -------------------
+
+// Compressed Sparse Row layout, same as CSR Graph/main.cpp:
+// the out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+CSRGraph<double> to_csr(const std::vector<std::vector<Edge>>& graph)
+{
+    const int n = static_cast<int>(graph.size());
+    CSRBuilder<double> builder(n);
+    for (int u = 0; u < n; ++u) {
+        for (const Edge& e : graph[u]) {
+            builder.add_edge(u, e.to, e.weight);
+        }
+    }
+    return builder.build();
+}
+
+// Reusable A* workspace with generation-counter (timestamp) invalidation.
+// stamp[v] == generation means g/h/parent of v belong to the current query,
+// closed_stamp[v] == generation means v is closed. Starting a query is one
+// increment, so repeated queries cost O(explored region), not O(n).
+struct AStarWorkspace {
+    std::vector<double> g;
+    std::vector<double> h;
+    std::vector<int> parent;
+    std::vector<unsigned> stamp;
+    std::vector<unsigned> closed_stamp;
+    unsigned generation = 0;
+    std::vector<std::pair<double, int>> heap;   // binary heap, capacity reused
+
+    explicit AStarWorkspace(int n)
+        : g(n), h(n), parent(n), stamp(n, 0), closed_stamp(n, 0) {}
+
+    void next_query()
+    {
+        heap.clear();
+        if (++generation == 0) {   // wrapped around: invalidate everything once
+            std::fill(stamp.begin(), stamp.end(), 0);
+            std::fill(closed_stamp.begin(), closed_stamp.end(), 0);
+            generation = 1;
+        }
+    }
+
+    bool reached(int v) const { return stamp[v] == generation; }
+    bool closed(int v) const { return closed_stamp[v] == generation; }
+    double dist(int v) const { return reached(v) ? g[v] : std::numeric_limits<double>::infinity(); }
+};
+
+// A* over a CSR graph: identical search, contiguous neighbour scans.
+// heuristic(v) is any callable returning an admissible estimate of the
+// distance from v to goal; it is evaluated once, when v is first reached.
+template <typename Heuristic>
+AStarResult astar_search(int start,
+                         int goal,
+                         const CSRGraph<double>& graph,
+                         Heuristic&& heuristic,
+                         AStarWorkspace& ws)
+{
+    const double INF = std::numeric_limits<double>::infinity();
+    const auto later = std::greater<>();
+
+    ws.next_query();
+
+    ws.stamp[start] = ws.generation;
+    ws.g[start] = 0.0;
+    ws.h[start] = heuristic(start);
+    ws.parent[start] = -1;
+    ws.heap.emplace_back(ws.h[start], start);
+
+    while (!ws.heap.empty()) {
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), later);
+        auto [f, u] = ws.heap.back();
+        ws.heap.pop_back();
+
+        if (f > ws.g[u] + ws.h[u]) {
+            continue;
+        }
+
+        if (u == goal) {
+            break;
+        }
+
+        if (ws.closed(u)) {
+            continue;
+        }
+        ws.closed_stamp[u] = ws.generation;
+
+        for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+            int v = graph.target[e];
+            if (ws.closed(v)) {
+                continue;
+            }
+
+            double tentative_g = ws.g[u] + graph.weight[e];
+            if (!ws.reached(v)) {
+                ws.stamp[v] = ws.generation;
+                ws.g[v] = INF;
+                ws.h[v] = heuristic(v);
+            }
+            if (tentative_g < ws.g[v]) {
+                ws.g[v] = tentative_g;
+                ws.parent[v] = u;
+                ws.heap.emplace_back(ws.g[v] + ws.h[v], v);
+                std::push_heap(ws.heap.begin(), ws.heap.end(), later);
+            }
+        }
+    }
+
+    AStarResult result;
+    const double dist = ws.dist(goal);
+
+    if (dist == INF) {
+        result.distance = INF;
+        result.found = false;
+        return result;
+    }
+
+    std::vector<int> path;
+    for (int cur = goal; cur != -1; cur = ws.parent[cur]) {
+        path.push_back(cur);
+    }
+    std::reverse(path.begin(), path.end());
+
+    result.distance = dist;
+    result.path = std::move(path);
+    result.found = true;
+    return result;
+}
+
+// One-off query: same search with a fresh workspace
+template <typename Heuristic>
+AStarResult astar_search(int start,
+                         int goal,
+                         const CSRGraph<double>& graph,
+                         Heuristic&& heuristic)
+{
+    AStarWorkspace ws(graph.n);
+    return astar_search(start, goal, graph, heuristic, ws);
+}
+
+AStarResult astar(int start,
+                  int goal,
+                  const CSRGraph<double>& graph,
+                  const std::vector<double>& heuristic)
+{
+    return astar_search(start, goal, graph, [&](int v) { return heuristic[v]; });
+}
+
+AStarResult astar(int start,
+                  int goal,
+                  const CSRGraph<double>& graph,
+                  const std::vector<double>& heuristic,
+                  AStarWorkspace& ws)
+{
+    return astar_search(start, goal, graph, [&](int v) { return heuristic[v]; }, ws);
+}
+
+// ------------------- ALT landmarks (A*, Landmarks, Triangle inequality) -------------------
+
+// For a landmark L and any vertices v, t the triangle inequality gives
+//   d(v, t) >= d(L, t) - d(L, v)     and     d(v, t) >= d(v, L) - d(t, L)
+// so the max over k landmarks is an admissible and consistent heuristic for
+// ANY goal, computed on the fly from 2k precomputed distances per vertex.
+// No coordinates or metric weights needed, only non-negative edge weights.
+
+enum class LandmarkSelection {
+    Farthest,   // each new landmark is the vertex farthest from the chosen ones
+    Avoid       // Goldberg & Werneck: leaf of the worst-covered shortest-path subtree
+};
+
+struct LandmarkTable {
+    int n = 0;
+    int k = 0;
+    std::vector<int> landmarks;
+    std::vector<double> from;   // from[v * k + i] = d(landmark i, v)
+    std::vector<double> to;     // to[v * k + i]   = d(v, landmark i)
+
+    // Admissible lower bound on d(v, goal)
+    double lower_bound(int v, int goal) const
+    {
+        const double INF = std::numeric_limits<double>::infinity();
+        const double* fv = &from[static_cast<std::size_t>(v) * k];
+        const double* tv = &to[static_cast<std::size_t>(v) * k];
+        const double* fg = &from[static_cast<std::size_t>(goal) * k];
+        const double* tg = &to[static_cast<std::size_t>(goal) * k];
+
+        double best = 0.0;
+        for (int i = 0; i < k; ++i) {
+            if (fg[i] != INF && fv[i] != INF) {
+                best = std::max(best, fg[i] - fv[i]);
+            }
+            if (tv[i] != INF && tg[i] != INF) {
+                best = std::max(best, tv[i] - tg[i]);
+            }
+        }
+        return best;
+    }
+};
+
+// Plain Dijkstra on a CSR graph (distances + parents), used for preprocessing
+void shortest_path_tree(const CSRGraph<double>& graph,
+                        int source,
+                        std::vector<double>& dist,
+                        std::vector<int>& parent,
+                        std::vector<int>& order)   // vertices in settling order
+{
+    const double INF = std::numeric_limits<double>::infinity();
+    dist.assign(graph.n, INF);
+    parent.assign(graph.n, -1);
+    order.clear();
+
+    using State = std::pair<double, int>;
+    std::priority_queue<State, std::vector<State>, std::greater<State>> pq;
+
+    dist[source] = 0.0;
+    pq.emplace(0.0, source);
+
+    while (!pq.empty()) {
+        auto [d, u] = pq.top();
+        pq.pop();
+        if (d != dist[u]) {
+            continue;
+        }
+        order.push_back(u);
+        for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+            int v = graph.target[e];
+            if (d + graph.weight[e] < dist[v]) {
+                dist[v] = d + graph.weight[e];
+                parent[v] = u;
+                pq.emplace(dist[v], v);
+            }
+        }
+    }
+}
+
+// Select k landmarks and store forward/backward distance tables.
+// graph: the graph, reverse: its transpose (the same graph if undirected).
+// Cost: 2k Dijkstra runs (plus one per landmark for Avoid selection).
+LandmarkTable build_landmarks(const CSRGraph<double>& graph,
+                              const CSRGraph<double>& reverse,
+                              int k,
+                              LandmarkSelection selection = LandmarkSelection::Farthest,
+                              unsigned seed = 12345)
+{
+    const int n = graph.n;
+    const double INF = std::numeric_limits<double>::infinity();
+    k = std::min(k, n);
+
+    std::vector<std::vector<double>> from_l;   // from_l[i][v] = d(L_i, v)
+    std::vector<std::vector<double>> to_l;     // to_l[i][v]   = d(v, L_i)
+    std::vector<int> landmarks;
+    std::vector<double> dist;
+    std::vector<int> parent;
+    std::vector<int> order;
+    std::vector<bool> is_landmark(n, false);
+
+    // Lower bound on d(a, b) from the landmarks chosen so far
+    auto bound = [&](int a, int b) {
+        double best = 0.0;
+        for (std::size_t i = 0; i < landmarks.size(); ++i) {
+            if (from_l[i][b] != INF && from_l[i][a] != INF) {
+                best = std::max(best, from_l[i][b] - from_l[i][a]);
+            }
+            if (to_l[i][a] != INF && to_l[i][b] != INF) {
+                best = std::max(best, to_l[i][a] - to_l[i][b]);
+            }
+        }
+        return best;
+    };
+
+    // Farthest: maximise the distance to the closest landmark (unreached = infinitely far)
+    auto pick_farthest = [&]() {
+        int best_v = -1;
+        double best_d = -1.0;
+        for (int v = 0; v < n; ++v) {
+            if (is_landmark[v]) {
+                continue;
+            }
+            double closest = INF;
+            for (std::size_t i = 0; i < landmarks.size(); ++i) {
+                closest = std::min(closest, from_l[i][v]);
+            }
+            if (landmarks.empty()) {
+                closest = dist[v];   // distances from the initial root
+            }
+            if (closest > best_d) {
+                best_d = closest;
+                best_v = v;
+            }
+        }
+        return best_v;
+    };
+
+    std::mt19937 rng(seed);
+
+    if (n > 0) {
+        int root = static_cast<int>(rng() % n);
+        shortest_path_tree(graph, root, dist, parent, order);
+    }
+
+    while (static_cast<int>(landmarks.size()) < k) {
+        int chosen = -1;
+
+        if (selection == LandmarkSelection::Avoid) {
+            // Weight of v = how badly the current landmarks bound d(root, v);
+            // size of v = total weight of its subtree, 0 if it holds a landmark.
+            int root = static_cast<int>(rng() % n);
+            shortest_path_tree(graph, root, dist, parent, order);
+
+            std::vector<double> size(n, 0.0);
+            std::vector<bool> covered(n, false);
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                int v = *it;
+                covered[v] = covered[v] || is_landmark[v];
+                if (covered[v]) {
+                    size[v] = 0.0;
+                } else {
+                    size[v] += dist[v] - bound(root, v);
+                }
+                if (parent[v] != -1) {
+                    covered[parent[v]] = covered[parent[v]] || covered[v];
+                    size[parent[v]] += size[v];
+                }
+            }
+
+            // The root reaches every landmark it can see, so it is covered as
+            // soon as one landmark is reachable: start from the heaviest
+            // uncovered subtree instead, then walk its heaviest children to a leaf.
+            std::vector<int> heaviest(n, -1);
+            int top = -1;
+            for (int v : order) {
+                if (covered[v]) {
+                    continue;
+                }
+                int p = parent[v];
+                if (p != -1 && (heaviest[p] == -1 || size[v] > size[heaviest[p]])) {
+                    heaviest[p] = v;
+                }
+                if (top == -1 || size[v] > size[top]) {
+                    top = v;
+                }
+            }
+            if (top != -1 && size[top] > 0.0) {
+                chosen = top;
+                while (heaviest[chosen] != -1) {
+                    chosen = heaviest[chosen];
+                }
+            }
+        }
+
+        if (chosen == -1 || is_landmark[chosen]) {
+            chosen = pick_farthest();
+        }
+
+        is_landmark[chosen] = true;
+        landmarks.push_back(chosen);
+
+        shortest_path_tree(graph, chosen, dist, parent, order);
+        from_l.push_back(dist);
+        shortest_path_tree(reverse, chosen, dist, parent, order);
+        to_l.push_back(dist);
+    }
+
+    // Interleave per vertex so one lookup touches two contiguous k-blocks
+    LandmarkTable table;
+    table.n = n;
+    table.k = k;
+    table.landmarks = std::move(landmarks);
+    table.from.resize(static_cast<std::size_t>(n) * k);
+    table.to.resize(static_cast<std::size_t>(n) * k);
+    for (int v = 0; v < n; ++v) {
+        for (int i = 0; i < k; ++i) {
+            table.from[static_cast<std::size_t>(v) * k + i] = from_l[i][v];
+            table.to[static_cast<std::size_t>(v) * k + i] = to_l[i][v];
+        }
+    }
+    return table;
+}
+
+// A* with the ALT heuristic: no per-goal heuristic array needed
+AStarResult astar(int start,
+                  int goal,
+                  const CSRGraph<double>& graph,
+                  const LandmarkTable& landmarks)
+{
+    return astar_search(start, goal, graph, [&](int v) { return landmarks.lower_bound(v, goal); });
+}
+
+// ALT with a reusable workspace: the natural pairing for many queries
+AStarResult astar(int start,
+                  int goal,
+                  const CSRGraph<double>& graph,
+                  const LandmarkTable& landmarks,
+                  AStarWorkspace& ws)
+{
+    return astar_search(start, goal, graph, [&](int v) { return landmarks.lower_bound(v, goal); }, ws);
+}
+
+// ------------------- Indexed 4-ary heap -------------------
+
+// Addressable D-ary min-heap over vertex ids 0..n-1 with decrease-key.
+// pos[v] is the slot of v in heap[] (-1 if absent), so every vertex is stored
+// at most once: the heap never exceeds n entries, unlike lazy deletion.
+// D = 4 keeps the tree shallow and the children of a node in one cache line.
+template <typename Key, int D = 4>
+struct IndexedHeap {
+    std::vector<int> heap;   // heap[i] = vertex
+    std::vector<Key> key;    // key[v]  = priority of vertex v
+    std::vector<int> pos;    // pos[v]  = index of v in heap, or -1
+
+    explicit IndexedHeap(int n) : key(n), pos(n, -1) { heap.reserve(n); }
+
+    bool empty() const { return heap.empty(); }
+    bool contains(int v) const { return pos[v] != -1; }
+
+    void push(int v, Key k)
+    {
+        key[v] = k;
+        pos[v] = static_cast<int>(heap.size());
+        heap.push_back(v);
+        sift_up(pos[v]);
+    }
+
+    // Requires k <= the current key of v
+    void decrease_key(int v, Key k)
+    {
+        key[v] = k;
+        sift_up(pos[v]);
+    }
+
+    void push_or_decrease(int v, Key k)
+    {
+        if (contains(v)) {
+            decrease_key(v, k);
+        } else {
+            push(v, k);
+        }
+    }
+
+    std::pair<Key, int> pop()
+    {
+        int top = heap[0];
+        pos[top] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            pos[last] = 0;
+            sift_down(0);
+        }
+        return {key[top], top};
+    }
+
+    void sift_up(int i)
+    {
+        int v = heap[i];
+        while (i > 0) {
+            int p = (i - 1) / D;
+            if (!(key[v] < key[heap[p]])) {
+                break;
+            }
+            heap[i] = heap[p];
+            pos[heap[i]] = i;
+            i = p;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+    void sift_down(int i)
+    {
+        const int size = static_cast<int>(heap.size());
+        int v = heap[i];
+        while (true) {
+            int first = i * D + 1;
+            if (first >= size) {
+                break;
+            }
+            int best = first;
+            int end = std::min(first + D, size);
+            for (int c = first + 1; c < end; ++c) {
+                if (key[heap[c]] < key[heap[best]]) {
+                    best = c;
+                }
+            }
+            if (!(key[heap[best]] < key[v])) {
+                break;
+            }
+            heap[i] = heap[best];
+            pos[heap[i]] = i;
+            i = best;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+};
+
+// A* with an indexed 4-ary heap keyed on f = g + h. An open vertex that is
+// reached by a shorter path has its key decreased in place, so the heap
+// never holds more than n entries and no outdated states are popped.
+AStarResult astar_decrease_key(int start,
+                               int goal,
+                               const CSRGraph<double>& graph,
+                               const std::vector<double>& heuristic)
+{
+    const int n = graph.n;
+    const double INF = std::numeric_limits<double>::infinity();
+
+    std::vector<double> g(n, INF);
+    std::vector<int> parent(n, -1);
+    std::vector<bool> closed(n, false);
+
+    IndexedHeap<double> open(n);
+
+    g[start] = 0.0;
+    open.push(start, heuristic[start]);
+
+    while (!open.empty()) {
+        int u = open.pop().second;
+
+        if (u == goal) {
+            break;
+        }
+        closed[u] = true;
+
+        for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+            int v = graph.target[e];
+            if (closed[v]) {
+                continue;
+            }
+
+            double tentative_g = g[u] + graph.weight[e];
+            if (tentative_g < g[v]) {
+                g[v] = tentative_g;
+                parent[v] = u;
+                open.push_or_decrease(v, g[v] + heuristic[v]);
+            }
+        }
+    }
+
+    AStarResult result;
+    const double dist = g[goal];
+
+    if (dist == INF) {
+        result.distance = INF;
+        result.found = false;
+        return result;
+    }
+
+    std::vector<int> path;
+    for (int cur = goal; cur != -1; cur = parent[cur]) {
+        path.push_back(cur);
+    }
+    std::reverse(path.begin(), path.end());
+
+    result.distance = dist;
+    result.path = std::move(path);
+    result.found = true;
+    return result;
+}
+
 // ------------------- Example usage in main -------------------
 
 int main() {
@@ -170,7 +803,10 @@ int main() {
         heuristic[v] = euclidean(v, goal);
     }
 
-    AStarResult res = astar(start, goal, graph, heuristic);
+    // Flatten the adjacency list once, then query the CSR form
+    CSRGraph<double> csr = to_csr(graph);
+
+    AStarResult res = astar(start, goal, csr, heuristic);
 
     if (!res.found) {
         std::cout << "No path found from " << start << " to " << goal << '\n';
@@ -189,5 +825,39 @@ int main() {
     }
     std::cout << '\n';
 
+    // Same query with ALT: landmark bounds instead of coordinates
+    LandmarkTable landmarks = build_landmarks(csr, csr, 2, LandmarkSelection::Avoid);
+    AStarResult alt = astar(start, goal, csr, landmarks);
+
+    std::cout << "ALT distance from " << start << " to " << goal << " = "
+              << alt.distance << '\n';
+
+    // Landmark selection on a "broom": one long handle 0-1 (weight 10) versus
+    // a short stick 0-2 fanning out to five bristles 3..7 (weight 2 each).
+    // Farthest spreads out (1 3). Avoid, once bristle 3 is a landmark, still
+    // sees bristle-to-bristle distances bounded by 0 and takes another
+    // bristle (3 4) instead of falling back to the handle.
+    std::vector<std::vector<Edge>> broom(8);
+    auto add_broom_edge = [&](int u, int v, double w) {
+        broom[u].push_back({v, w});
+        broom[v].push_back({u, w});
+    };
+    add_broom_edge(0, 1, 10.0);
+    add_broom_edge(0, 2, 1.0);
+    for (int v = 3; v < 8; ++v) {
+        add_broom_edge(2, v, 2.0);
+    }
+    CSRGraph<double> broom_csr = to_csr(broom);
+
+    for (LandmarkSelection selection : {LandmarkSelection::Farthest, LandmarkSelection::Avoid}) {
+        LandmarkTable table = build_landmarks(broom_csr, broom_csr, 2, selection, 3);
+        std::cout << (selection == LandmarkSelection::Avoid ? "Avoid" : "Farthest")
+                  << " landmarks:";
+        for (int l : table.landmarks) {
+            std::cout << ' ' << l;
+        }
+        std::cout << '\n';
+    }
+
     return 0;
 }
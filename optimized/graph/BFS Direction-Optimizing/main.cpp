@@ -0,0 +1,267 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+// ------------------------------------------------------------
+// Compressed Sparse Row (CSR) graph – see CSR Graph/main.cpp
+// ------------------------------------------------------------
+// The out-edges of u are target[offset[u] .. offset[u + 1]),
+// weights (if any) in weight[]. Flat arrays, no per-vertex
+// allocations, contiguous neighbour scans.
+// ------------------------------------------------------------
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Reverse every edge; gives the in-edges needed by bottom-up steps.
+template <typename W>
+CSRGraph<W> transpose(const CSRGraph<W>& g)
+{
+    CSRBuilder<W> builder(g.n, !g.weight.empty());
+    builder.reserve(g.num_edges());
+    for (int u = 0; u < g.n; ++u) {
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            builder.add_edge(g.target[e], u, g.weight.empty() ? W{} : g.weight[e]);
+        }
+    }
+    return builder.build();
+}
+
+CSRGraph<int> to_csr(const std::vector<std::vector<int>>& graph)
+{
+    const int n = static_cast<int>(graph.size());
+    CSRBuilder<int> builder(n, false);
+    for (int u = 0; u < n; ++u) {
+        for (int v : graph[u]) {
+            builder.add_edge(u, v);
+        }
+    }
+    return builder.build();
+}
+
+// ------------------------------------------------------------
+// Direction-Optimizing BFS (Beamer et al.)
+// ------------------------------------------------------------
+// Top-down steps scan the out-edges of the frontier (a queue).
+// Bottom-up steps let every unvisited vertex scan its in-edges
+// until it finds a parent in the frontier (a bitmap), which is
+// far cheaper once the frontier covers a large part of the
+// graph, because most in-edge scans stop after a few edges.
+//
+// Switching rules (frontier = f, unvisited = u):
+//   top-down  -> bottom-up  when  edges(f) > edges(u) / alpha
+//   bottom-up -> top-down   when  |f| < n / beta and |f| shrinks
+// ------------------------------------------------------------
+struct DirectionOptimizingParams {
+    int alpha = 15;
+    int beta = 18;
+};
+
+struct BFSTree {
+    std::vector<int> level;    // level[v] = hops from source, -1 if unreached
+    std::vector<int> parent;   // parent[v] = BFS tree parent, -1 for source/unreached
+};
+
+// out: the graph, in: its transpose (pass the same graph twice if undirected)
+BFSTree direction_optimizing_bfs(const CSRGraph<int>& out,
+                                 const CSRGraph<int>& in,
+                                 int source,
+                                 DirectionOptimizingParams params = {})
+{
+    const int n = out.n;
+    const int words = (n + 63) / 64;
+
+    BFSTree tree;
+    tree.level.assign(n, -1);
+    tree.parent.assign(n, -1);
+
+    std::vector<int> queue;        // sparse frontier (top-down)
+    std::vector<int> next_queue;
+    std::vector<std::uint64_t> bitmap(words, 0);       // dense frontier (bottom-up)
+    std::vector<std::uint64_t> next_bitmap(words, 0);
+
+    tree.level[source] = 0;
+    queue.push_back(source);
+
+    long long edges_frontier = out.degree(source);
+    long long edges_unvisited = out.num_edges() - edges_frontier;
+    long long frontier_size = 1;
+    long long prev_size = 0;
+    bool bottom_up = false;
+
+    for (int depth = 1; frontier_size > 0; ++depth) {
+        // ----------------------------------------------------
+        // Pick the direction for this level
+        // ----------------------------------------------------
+        const bool growing = frontier_size > prev_size;
+        if (!bottom_up) {
+            if (growing && edges_frontier > edges_unvisited / params.alpha) {
+                bottom_up = true;
+                std::fill(bitmap.begin(), bitmap.end(), 0);
+                for (int u : queue) {
+                    bitmap[u >> 6] |= std::uint64_t{1} << (u & 63);
+                }
+            }
+        } else if (!growing && frontier_size < n / params.beta) {
+            bottom_up = false;
+            queue.clear();
+            for (int w = 0; w < words; ++w) {
+                for (std::uint64_t bits = bitmap[w]; bits != 0; bits &= bits - 1) {
+                    queue.push_back(w * 64 + std::countr_zero(bits));
+                }
+            }
+        }
+
+        long long next_size = 0;
+        long long next_edges = 0;
+
+        if (!bottom_up) {
+            // ------------------------------------------------
+            // Top-down: frontier pushes to its out-neighbours
+            // ------------------------------------------------
+            next_queue.clear();
+            for (int u : queue) {
+                for (int e = out.offset[u]; e < out.offset[u + 1]; ++e) {
+                    int v = out.target[e];
+                    if (tree.level[v] == -1) {
+                        tree.level[v] = depth;
+                        tree.parent[v] = u;
+                        next_queue.push_back(v);
+                        next_edges += out.degree(v);
+                    }
+                }
+            }
+            queue.swap(next_queue);
+            next_size = static_cast<long long>(queue.size());
+        } else {
+            // ------------------------------------------------
+            // Bottom-up: unvisited vertices pull from frontier
+            // ------------------------------------------------
+            std::fill(next_bitmap.begin(), next_bitmap.end(), 0);
+            for (int v = 0; v < n; ++v) {
+                if (tree.level[v] != -1) {
+                    continue;
+                }
+                for (int e = in.offset[v]; e < in.offset[v + 1]; ++e) {
+                    int u = in.target[e];
+                    if (bitmap[u >> 6] >> (u & 63) & 1) {
+                        tree.level[v] = depth;
+                        tree.parent[v] = u;
+                        next_bitmap[v >> 6] |= std::uint64_t{1} << (v & 63);
+                        ++next_size;
+                        next_edges += out.degree(v);
+                        break;
+                    }
+                }
+            }
+            bitmap.swap(next_bitmap);
+        }
+
+        prev_size = frontier_size;
+        frontier_size = next_size;
+        edges_unvisited -= next_edges;
+        edges_frontier = next_edges;
+    }
+
+    return tree;
+}
+
+int main()
+{
+    // Same example graph as the BFS template
+    // 0 -- 1 -- 2
+    // |         |
+    // 4 -- 3 ---+
+    std::vector<std::vector<int>> graph = {
+        {1, 4},    // Node 0
+        {0, 2},    // Node 1
+        {1, 3},    // Node 2
+        {2, 4},    // Node 3
+        {0, 3}     // Node 4
+    };
+
+    CSRGraph<int> out = to_csr(graph);
+    CSRGraph<int> in = transpose(out);   // == out here, the graph is undirected
+
+    int start_vertex = 0;
+
+    BFSTree tree = direction_optimizing_bfs(out, in, start_vertex);
+
+    std::cout << "BFS starting from vertex " << start_vertex << ":\n";
+    for (int v = 0; v < out.n; ++v) {
+        std::cout << "Vertex " << v << ": level = " << tree.level[v]
+                  << ", parent = " << tree.parent[v] << "\n";
+    }
+
+    return 0;
+}
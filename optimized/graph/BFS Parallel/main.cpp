@@ -0,0 +1,298 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <climits>
+#include <cstdint>
+#include <thread>
+
+// ------------------------------------------------------------
+// Compressed Sparse Row (CSR) graph – see CSR Graph/main.cpp
+// ------------------------------------------------------------
+// The out-edges of u are target[offset[u] .. offset[u + 1]),
+// weights (if any) in weight[]. Flat arrays, no per-vertex
+// allocations, contiguous neighbour scans.
+// ------------------------------------------------------------
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+CSRGraph<int> to_csr(const std::vector<std::vector<int>>& graph)
+{
+    const int n = static_cast<int>(graph.size());
+    CSRBuilder<int> builder(n, false);
+    for (int u = 0; u < n; ++u) {
+        for (int v : graph[u]) {
+            builder.add_edge(u, v);
+        }
+    }
+    return builder.build();
+}
+
+struct BFSTree {
+    std::vector<int> level;    // level[v] = hops from source, -1 if unreached
+    std::vector<int> parent;   // parent[v] = BFS tree parent, -1 for source/unreached
+};
+
+// ------------------------------------------------------------
+// Sequential reference BFS (queue order = template BFS order)
+// ------------------------------------------------------------
+BFSTree sequential_bfs(const CSRGraph<int>& graph, int source)
+{
+    BFSTree tree;
+    tree.level.assign(graph.n, -1);
+    tree.parent.assign(graph.n, -1);
+
+    std::vector<int> queue{source};
+    tree.level[source] = 0;
+
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        int u = queue[head];
+        for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+            int v = graph.target[e];
+            if (tree.level[v] == -1) {
+                tree.level[v] = tree.level[u] + 1;
+                tree.parent[v] = u;
+                queue.push_back(v);
+            }
+        }
+    }
+    return tree;
+}
+
+// ------------------------------------------------------------
+// Parallel level-synchronous BFS
+// ------------------------------------------------------------
+// A fixed pool of threads (the caller is thread 0) runs every
+// level in three barrier-separated phases over its own slice of
+// the frontier:
+//   1. for every edge u -> v into an unvisited v, atomically
+//      keep the smallest frontier position of a parent in best[v]
+//   2. the owner of best[v] claims v with a CAS on the visited
+//      bitmap, writes level/parent, appends v to its own buffer
+//   3. buffers are copied into the next frontier at offsets from
+//      a prefix sum (no lock, each thread writes its own range)
+// Slices are contiguous and buffers are concatenated in thread
+// order, so parents and frontier order are exactly those of the
+// sequential queue BFS, whatever the thread count.
+// ------------------------------------------------------------
+BFSTree parallel_bfs(const CSRGraph<int>& graph,
+                     int source,
+                     int num_threads = static_cast<int>(std::thread::hardware_concurrency()))
+{
+    const int n = graph.n;
+    const int words = (n + 63) / 64;
+    const int T = std::max(1, num_threads);
+
+    BFSTree tree;
+    tree.level.assign(n, -1);
+    tree.parent.assign(n, -1);
+
+    std::vector<std::atomic<std::uint64_t>> visited(words);
+    std::vector<std::atomic<int>> best(n);
+    for (int w = 0; w < words; ++w) {
+        visited[w].store(0, std::memory_order_relaxed);
+    }
+    for (int v = 0; v < n; ++v) {
+        best[v].store(INT_MAX, std::memory_order_relaxed);
+    }
+
+    std::vector<int> frontier{source};
+    std::vector<int> next;
+    std::vector<std::vector<int>> local(T);
+    std::vector<std::size_t> start(T + 1, 0);
+
+    tree.level[source] = 0;
+    visited[source >> 6].store(std::uint64_t{1} << (source & 63), std::memory_order_relaxed);
+
+    int depth = 0;
+    int phase = 0;
+    bool done = false;
+
+    // Serial bookkeeping, run by the last thread to reach each barrier
+    auto on_phase_end = [&]() noexcept {
+        if (phase == 1) {
+            for (int t = 0; t < T; ++t) {
+                start[t + 1] = start[t] + local[t].size();
+            }
+            next.resize(start[T]);
+        } else if (phase == 2) {
+            frontier.swap(next);
+            ++depth;
+            done = frontier.empty();
+        }
+        phase = (phase + 1) % 3;
+    };
+    std::barrier sync(T, on_phase_end);
+
+    auto claim = [&](int v) -> bool {
+        std::atomic<std::uint64_t>& word = visited[v >> 6];
+        const std::uint64_t bit = std::uint64_t{1} << (v & 63);
+        std::uint64_t old = word.load(std::memory_order_relaxed);
+        while (!(old & bit)) {
+            if (word.compare_exchange_weak(old, old | bit, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto worker = [&](int t) {
+        while (!done) {
+            const std::size_t f = frontier.size();
+            const int lo = static_cast<int>(f * t / T);
+            const int hi = static_cast<int>(f * (t + 1) / T);
+
+            // Phase 1: lowest frontier position wins each new vertex
+            for (int i = lo; i < hi; ++i) {
+                int u = frontier[i];
+                for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+                    int v = graph.target[e];
+                    if (visited[v >> 6].load(std::memory_order_relaxed) >> (v & 63) & 1) {
+                        continue;
+                    }
+                    int cur = best[v].load(std::memory_order_relaxed);
+                    while (i < cur && !best[v].compare_exchange_weak(cur, i, std::memory_order_relaxed)) {
+                    }
+                }
+            }
+            sync.arrive_and_wait();
+
+            // Phase 2: winners claim their vertices into the local buffer
+            local[t].clear();
+            for (int i = lo; i < hi; ++i) {
+                int u = frontier[i];
+                for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+                    int v = graph.target[e];
+                    if (best[v].load(std::memory_order_relaxed) == i && claim(v)) {
+                        tree.level[v] = depth + 1;
+                        tree.parent[v] = u;
+                        local[t].push_back(v);
+                    }
+                }
+            }
+            sync.arrive_and_wait();
+
+            // Phase 3: lock-free merge into the next frontier
+            std::copy(local[t].begin(), local[t].end(), next.begin() + start[t]);
+            for (int v : local[t]) {
+                best[v].store(INT_MAX, std::memory_order_relaxed);
+            }
+            sync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(T - 1);
+    for (int t = 1; t < T; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (std::thread& th : pool) {
+        th.join();
+    }
+
+    return tree;
+}
+
+int main()
+{
+    // Same example graph as the BFS template
+    // 0 -- 1 -- 2
+    // |         |
+    // 4 -- 3 ---+
+    std::vector<std::vector<int>> graph = {
+        {1, 4},    // Node 0
+        {0, 2},    // Node 1
+        {1, 3},    // Node 2
+        {2, 4},    // Node 3
+        {0, 3}     // Node 4
+    };
+
+    CSRGraph<int> csr = to_csr(graph);
+
+    int start_vertex = 0;
+
+    BFSTree tree = parallel_bfs(csr, start_vertex, 4);
+    BFSTree reference = sequential_bfs(csr, start_vertex);
+
+    std::cout << "BFS starting from vertex " << start_vertex << ":\n";
+    for (int v = 0; v < csr.n; ++v) {
+        std::cout << "Vertex " << v << ": level = " << tree.level[v]
+                  << ", parent = " << tree.parent[v] << "\n";
+    }
+
+    bool same = tree.level == reference.level && tree.parent == reference.parent;
+    std::cout << "Matches sequential BFS: " << (same ? "yes" : "no") << "\n";
+
+    return 0;
+}
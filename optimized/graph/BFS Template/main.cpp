@@ -2,13 +2,37 @@
 #include <vector>
 #include <queue>
 
+// ------------------------------------------------------------
+// BFS visitor
+// ------------------------------------------------------------
+// The searches below are templates on the visitor type, so the
+// hooks are resolved and inlined at compile time (no virtual
+// calls, no I/O unless a hook does it). Derive from BFSVisitor
+// and hide only the hooks you need.
+//   discover_vertex(u)   u is reached for the first time
+//   examine_edge(u, v)   edge u -> v is scanned
+//   finish_vertex(u)     all edges of u are done
+// Vertices are discovered and finished in queue order.
+// ------------------------------------------------------------
+struct BFSVisitor {
+    void discover_vertex(int) {}
+    void examine_edge(int, int) {}
+    void finish_vertex(int) {}
+};
+
+// Prints every vertex in BFS order (the original template output)
+struct PrintBFSVisitor : BFSVisitor {
+    void discover_vertex(int u) { std::cout << "Visited: " << u << "\n"; }
+};
+
 // ------------------------------------------------------------
 // Breadth-First Search (BFS)
 // ------------------------------------------------------------
 // Performs BFS starting from a given source vertex.
 // The graph is represented as an adjacency list.
 // ------------------------------------------------------------
-void BFS(const std::vector<std::vector<int>>& graph, int start)
+template <typename Visitor>
+void BFS(const std::vector<std::vector<int>>& graph, int start, Visitor&& vis)
 {
     int n = static_cast<int>(graph.size());
     std::vector<bool> visited(n, false);
@@ -16,25 +40,159 @@ void BFS(const std::vector<std::vector<int>>& graph, int start)
 
     // Start BFS from the source vertex
     visited[start] = true;
+    vis.discover_vertex(start);
     q.push(start);
 
     while (!q.empty()) {
         int u = q.front();
         q.pop();
 
-        // ----------------------------------------------------
-        // INSERT VERTEX PROCESSING CODE HERE
-         std::cout << "Visited: " << u << "\n";
-        // ----------------------------------------------------
         for (int v : graph[u]) {
+            vis.examine_edge(u, v);
+            if (!visited[v]) {
+                visited[v] = true;
+                vis.discover_vertex(v);
+                q.push(v);
+            }
+        }
+
+        vis.finish_vertex(u);
+    }
+}
+
+void BFS(const std::vector<std::vector<int>>& graph, int start)
+{
+    BFS(graph, start, PrintBFSVisitor{});
+}
+
+// ------------------------------------------------------------
+// Compressed Sparse Row (CSR) graph – see CSR Graph/main.cpp
+// ------------------------------------------------------------
+// The out-edges of u are target[offset[u] .. offset[u + 1]),
+// weights (if any) in weight[]. Flat arrays, no per-vertex
+// allocations, contiguous neighbour scans.
+// ------------------------------------------------------------
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+CSRGraph<int> to_csr(const std::vector<std::vector<int>>& graph)
+{
+    const int n = static_cast<int>(graph.size());
+    CSRBuilder<int> builder(n, false);
+    for (int u = 0; u < n; ++u) {
+        for (int v : graph[u]) {
+            builder.add_edge(u, v);
+        }
+    }
+    return builder.build();
+}
+
+// ------------------------------------------------------------
+// BFS over a CSR graph – same traversal order as above
+// ------------------------------------------------------------
+template <typename Visitor>
+void BFS(const CSRGraph<int>& graph, int start, Visitor&& vis)
+{
+    int n = graph.n;
+    std::vector<bool> visited(n, false);
+    std::queue<int> q;
+
+    visited[start] = true;
+    vis.discover_vertex(start);
+    q.push(start);
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+
+        for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+            int v = graph.target[e];
+            vis.examine_edge(u, v);
             if (!visited[v]) {
                 visited[v] = true;
+                vis.discover_vertex(v);
                 q.push(v);
             }
         }
+
+        vis.finish_vertex(u);
     }
 }
 
+void BFS(const CSRGraph<int>& graph, int start)
+{
+    BFS(graph, start, PrintBFSVisitor{});
+}
+
 int main()
 {
     // Example graph represented as an adjacency list
@@ -54,5 +212,25 @@ int main()
     std::cout << "BFS starting from vertex " << start_vertex << ":\n";
     BFS(graph, start_vertex);
 
+    CSRGraph<int> csr = to_csr(graph);
+
+    std::cout << "BFS (CSR) starting from vertex " << start_vertex << ":\n";
+    BFS(csr, start_vertex);
+
+    // Visitor hooks instead of printing: hop count of every vertex
+    struct LevelRecorder : BFSVisitor {
+        std::vector<int> level;
+        explicit LevelRecorder(int n) : level(n, -1) {}
+        void examine_edge(int u, int v) { if (level[v] == -1) level[v] = level[u] + 1; }
+    } levels(csr.n);
+    levels.level[start_vertex] = 0;
+    BFS(csr, start_vertex, levels);
+
+    std::cout << "Levels:";
+    for (int d : levels.level) {
+        std::cout << " " << d;
+    }
+    std::cout << "\n";
+
     return 0;
 }
@@ -1,4 +1,7 @@
 #include <bits/stdc++.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 // Edge representation: directed edge u -> v with weight w
 struct Edge {
     int from;
@@ -11,8 +14,101 @@ struct BellmanFordResult {
     std::vector<long long> dist;    // dist[v] = shortest distance from source to v (or INF)
     std::vector<int> parent;        // parent[v] = previous vertex on shortest path (or -1)
     bool has_negative_cycle{};        // true if ANY negative cycle is reachable from source
+    std::vector<int> negative_cycle;  // one such cycle, in edge order (last -> first closes it)
+    std::vector<char> minus_inf;      // minus_inf[v] = 1 if dist[v] is -infinity (dist[v] is then meaningless)
 };
 
+// Walk the parent pointers from x, which must lead into a cycle, and
+// return that cycle in edge order. n steps first make sure we stand on it.
+std::vector<int> cycle_through_parents(const std::vector<int>& parent, int x) {
+    const int n = static_cast<int>(parent.size());
+    for (int i = 0; i < n; ++i) {
+        x = parent[x];
+    }
+
+    std::vector<int> cycle;
+    int y = x;
+    do {
+        cycle.push_back(y);
+        y = parent[y];
+    } while (y != x);
+
+    std::ranges::reverse(cycle);
+    return cycle;
+}
+
+// Everything reachable from the seeds, in one BFS over the out-edges
+// (offset/target in CSR layout): those vertices get minus_inf = 1.
+// Returns the vertices that were newly marked.
+std::vector<int> mark_minus_inf(const std::vector<int>& offset, const std::vector<int>& target,
+                                const std::vector<int>& seeds, std::vector<char>& minus_inf) {
+    std::vector<int> queue;
+    for (int s : seeds) {
+        if (!minus_inf[s]) {
+            minus_inf[s] = 1;
+            queue.push_back(s);
+        }
+    }
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        int u = queue[head];
+        for (int e = offset[u]; e < offset[u + 1]; ++e) {
+            int v = target[e];
+            if (!minus_inf[v]) {
+                minus_inf[v] = 1;
+                queue.push_back(v);
+            }
+        }
+    }
+    return queue;
+}
+
+// Shared tail of the round-based variants, run after their n - 1 rounds.
+// for_each_edge(f) must call f(u, v, w) for every edge.
+//   1. One more relaxation pass. Nothing relaxes -> no negative cycle.
+//   2. Otherwise the parent chain of the LAST vertex relaxed in that pass
+//      ends in a negative cycle (it cannot reach the source acyclically,
+//      or its new dist would not beat every path of <= n - 1 edges).
+//   3. Each reachable negative cycle has a vertex relaxed in the pass, and
+//      every relaxed vertex is reachable from one, so a single BFS from the
+//      relaxed vertices marks exactly the -infinity set.
+// All of it is O(n + m).
+template <typename ForEachEdge>
+void finish_negative_cycles(BellmanFordResult& res, ForEachEdge&& for_each_edge) {
+    constexpr long long INF = std::numeric_limits<long long>::max() / 4;
+    const int n = static_cast<int>(res.dist.size());
+
+    res.minus_inf.assign(n, 0);
+    res.negative_cycle.clear();
+
+    std::vector<int> relaxed;
+    for_each_edge([&](int u, int v, long long w) {
+        if (res.dist[u] != INF && res.dist[u] + w < res.dist[v]) {
+            res.dist[v] = res.dist[u] + w;
+            res.parent[v] = u;
+            relaxed.push_back(v);
+        }
+    });
+
+    res.has_negative_cycle = !relaxed.empty();
+    if (!res.has_negative_cycle) {
+        return;
+    }
+
+    res.negative_cycle = cycle_through_parents(res.parent, relaxed.back());
+
+    // Out-edges grouped by source (counting sort) for the BFS
+    std::vector<int> offset(n + 1, 0);
+    for_each_edge([&](int u, int, long long) { ++offset[u + 1]; });
+    for (int u = 0; u < n; ++u) {
+        offset[u + 1] += offset[u];
+    }
+    std::vector<int> target(offset[n]);
+    std::vector<int> pos(offset.begin(), offset.end() - 1);
+    for_each_edge([&](int u, int v, long long) { target[pos[u]++] = v; });
+
+    mark_minus_inf(offset, target, relaxed, res.minus_inf);
+}
+
 // Bellman-Ford algorithm
 // n       : number of vertices (0...n-1)
 // edges   : list of directed edges
@@ -58,16 +154,462 @@ BellmanFordResult bellman_ford(int n, const std::vector<Edge>& edges, int source
     }
 
     // Check for negative-weight cycles reachable from the source
+    finish_negative_cycles(res, [&](auto&& f) {
+        for (const Edge& e : edges) {
+            f(e.from, e.to, e.weight);
+        }
+    });
+
+    return res;
+}
+
+// Compressed Sparse Row (CSR) graph, same layout as CSR Graph/main.cpp.
+// The out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m) {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{}) {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Group an Edge list by source vertex
+CSRGraph<long long> to_csr(int n, const std::vector<Edge>& edges) {
+    CSRBuilder<long long> builder(n);
+    builder.reserve(edges.size());
     for (const Edge& e : edges) {
-        if (res.dist[e.from] == INF) {
-            continue;
+        builder.add_edge(e.from, e.to, e.weight);
+    }
+    return builder.build();
+}
+
+// Bellman-Ford over a CSR graph.
+// Same rounds and early exit as above, but the edges of an unreached vertex
+// are skipped as a block instead of being tested one by one.
+BellmanFordResult bellman_ford(const CSRGraph<long long>& g, int source) {
+    constexpr long long INF = std::numeric_limits<long long>::max() / 4;
+    const int n = g.n;
+
+    BellmanFordResult res;
+    res.dist.assign(n, INF);
+    res.parent.assign(n, -1);
+    res.has_negative_cycle = false;
+
+    res.dist[source] = 0;
+
+    for (int i = 0; i < n - 1; ++i) {
+        bool any_relaxed = false;
+
+        for (int u = 0; u < n; ++u) {
+            const long long du = res.dist[u];
+            if (du == INF) {
+                continue;
+            }
+            for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+                long long candidate = du + g.weight[e];
+                if (candidate < res.dist[g.target[e]]) {
+                    res.dist[g.target[e]] = candidate;
+                    res.parent[g.target[e]] = u;
+                    any_relaxed = true;
+                }
+            }
         }
-        if (res.dist[e.from] + e.weight < res.dist[e.to]) {
-            res.has_negative_cycle = true;
+
+        if (!any_relaxed) {
             break;
         }
     }
 
+    finish_negative_cycles(res, [&](auto&& f) {
+        for (int u = 0; u < n; ++u) {
+            for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+                f(u, g.target[e], g.weight[e]);
+            }
+        }
+    });
+
+    return res;
+}
+
+// SPFA: queue-driven Bellman-Ford over a CSR graph (see to_csr).
+// Only vertices whose distance just dropped are queued, so a round costs
+// the out-edges of the changed vertices instead of all m edges; on typical
+// sparse inputs it runs in near-linear time (worst case still O(n * m)).
+// Queue order heuristics:
+//   - SLF (small label first): a vertex whose new dist is below the front's
+//     goes to the front of the deque, otherwise to the back.
+//   - LLL (large label last): while the front's dist is above the average
+//     dist in the queue, it is rotated to the back before being popped.
+// Negative cycles are detected by counting: len[v] = number of edges on
+// the path that gave v its dist. len[v] >= n triggers a parent walk; if it
+// closes a loop, that loop is a negative cycle (a parent-graph cycle always
+// is), otherwise len[v] is reset to the real depth. A found cycle is
+// recorded (the first one in negative_cycle), everything reachable from it
+// is marked minus_inf and dropped from the search, and the search goes on
+// until the remaining vertices settle, so minus_inf ends up complete and
+// the other dists are exact.
+BellmanFordResult spfa(const CSRGraph<long long>& g, int source) {
+    constexpr long long INF = std::numeric_limits<long long>::max() / 4;
+    const int n = g.n;
+
+    BellmanFordResult res;
+    res.dist.assign(n, INF);
+    res.parent.assign(n, -1);
+    res.has_negative_cycle = false;
+    res.minus_inf.assign(n, 0);
+
+    std::vector<int> len(n, 0);
+    std::vector<char> in_queue(n, 0);
+    std::deque<int> dq;
+    __int128 queued_sum = 0;   // sum of dist over queued vertices, for LLL
+    long long queued_count = 0;   // live entries only: dropped ones may still sit in dq
+
+    // Parent walk from v: the cycle it runs into, or empty if it reaches
+    // the source (then len[v] is corrected to the actual depth).
+    auto find_cycle = [&](int v) -> std::vector<int> {
+        int x = v;
+        for (int depth = 0; depth < n; ++depth) {
+            x = res.parent[x];
+            if (x == -1) {
+                len[v] = depth + 1;
+                return {};
+            }
+        }
+        return cycle_through_parents(res.parent, v);
+    };
+
+    res.dist[source] = 0;
+    dq.push_back(source);
+    in_queue[source] = 1;
+    queued_count = 1;
+
+    while (!dq.empty()) {
+        if (res.minus_inf[dq.front()]) {   // dropped while queued
+            dq.pop_front();
+            continue;
+        }
+
+        // LLL: push large labels back (at most one full rotation)
+        for (std::size_t k = dq.size(); k > 1; --k) {
+            int f = dq.front();
+            if (!res.minus_inf[f] &&
+                static_cast<__int128>(res.dist[f]) * queued_count <= queued_sum) {
+                break;
+            }
+            dq.pop_front();
+            dq.push_back(f);
+        }
+
+        int u = dq.front();
+        dq.pop_front();
+        if (res.minus_inf[u]) {
+            continue;
+        }
+        in_queue[u] = 0;
+        queued_sum -= res.dist[u];
+        --queued_count;
+
+        const long long du = res.dist[u];
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            int v = g.target[e];
+            long long candidate = du + g.weight[e];
+            if (res.minus_inf[v] || candidate >= res.dist[v]) {
+                continue;
+            }
+
+            if (in_queue[v]) {
+                queued_sum += candidate - res.dist[v];
+            }
+            res.dist[v] = candidate;
+            res.parent[v] = u;
+            len[v] = len[u] + 1;
+
+            if (len[v] >= n) {
+                std::vector<int> cycle = find_cycle(v);
+                if (!cycle.empty()) {
+                    if (!res.has_negative_cycle) {
+                        res.has_negative_cycle = true;
+                        res.negative_cycle = cycle;
+                    }
+                    // Drop the cycle and everything it reaches (v included)
+                    for (int x : mark_minus_inf(g.offset, g.target, cycle, res.minus_inf)) {
+                        if (in_queue[x]) {
+                            queued_sum -= res.dist[x];
+                            --queued_count;
+                        }
+                    }
+                    if (res.minus_inf[u]) {
+                        break;
+                    }
+                    continue;
+                }
+            }
+
+            if (in_queue[v]) {
+                continue;
+            }
+            in_queue[v] = 1;
+            queued_sum += candidate;
+            ++queued_count;
+            // SLF: smaller than the front -> front, else back
+            if (!dq.empty() && candidate < res.dist[dq.front()]) {
+                dq.push_front(v);
+            } else {
+                dq.push_back(v);
+            }
+        }
+    }
+
+    return res;
+}
+
+// Structure-of-arrays edge list grouped by DESTINATION.
+// The in-edges of v are [offset[v], offset[v + 1]) with sources in from[]
+// and weights in weight[]: each field is a contiguous array (good for
+// SIMD loads), and one vertex's in-edges can be relaxed by one thread
+// without racing with anyone else on dist[v].
+struct EdgeSoA {
+    int n = 0;
+    std::vector<int> offset;          // size n + 1
+    std::vector<int> from;            // size m
+    std::vector<long long> weight;    // size m
+};
+
+EdgeSoA to_soa_by_destination(int n, const std::vector<Edge>& edges) {
+    EdgeSoA g;
+    g.n = n;
+    g.offset.assign(n + 1, 0);
+    g.from.resize(edges.size());
+    g.weight.resize(edges.size());
+
+    for (const Edge& e : edges) {
+        ++g.offset[e.to + 1];
+    }
+    for (int v = 0; v < n; ++v) {
+        g.offset[v + 1] += g.offset[v];
+    }
+
+    std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+    for (const Edge& e : edges) {
+        int slot = pos[e.to]++;
+        g.from[slot] = e.from;
+        g.weight[slot] = e.weight;
+    }
+    return g;
+}
+
+// Smallest dist[from[e]] + weight[e] over the in-edges [begin, end) of one
+// vertex that beats `best`; best_edge is the first edge reaching it (or
+// unchanged if none does). Unreached sources (dist == INF) never count.
+// With AVX2, four candidates per step: gather dist[from[e]], add the
+// weights, mask unreached sources and keep a per-lane minimum; the lanes
+// are then reduced preferring the lowest edge id, so the result is the
+// same as the scalar loop.
+inline void best_in_edge(const long long* dist, const EdgeSoA& g, int begin, int end,
+                         long long& best, int& best_edge) {
+    constexpr long long INF = std::numeric_limits<long long>::max() / 4;
+    int e = begin;
+
+#ifdef __AVX2__
+    if (end - begin >= 8) {
+        const __m256i inf = _mm256_set1_epi64x(INF);
+        const __m256i step = _mm256_set1_epi64x(4);
+        __m256i lane_best = _mm256_set1_epi64x(best);
+        __m256i lane_edge = _mm256_set1_epi64x(-1);
+        __m256i ids = _mm256_setr_epi64x(e, e + 1, e + 2, e + 3);
+
+        for (; e + 4 <= end; e += 4) {
+            __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(g.from.data() + e));
+            __m256i d = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(dist), src, 8);
+            __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(g.weight.data() + e));
+            __m256i cand = _mm256_add_epi64(d, w);
+
+            __m256i better = _mm256_andnot_si256(_mm256_cmpeq_epi64(d, inf),
+                                                 _mm256_cmpgt_epi64(lane_best, cand));
+            lane_best = _mm256_blendv_epi8(lane_best, cand, better);
+            lane_edge = _mm256_blendv_epi8(lane_edge, ids, better);
+            ids = _mm256_add_epi64(ids, step);
+        }
+
+        alignas(32) long long value[4];
+        alignas(32) long long edge[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(value), lane_best);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(edge), lane_edge);
+        for (int l = 0; l < 4; ++l) {
+            if (edge[l] == -1) {
+                continue;
+            }
+            if (value[l] < best || (value[l] == best && edge[l] < best_edge)) {
+                best = value[l];
+                best_edge = static_cast<int>(edge[l]);
+            }
+        }
+    }
+#endif
+
+    for (; e < end; ++e) {
+        const long long d = dist[g.from[e]];
+        if (d == INF) {
+            continue;
+        }
+        if (d + g.weight[e] < best) {
+            best = d + g.weight[e];
+            best_edge = e;
+        }
+    }
+}
+
+// Parallel Bellman-Ford over the destination-grouped SoA layout.
+// Every round, each thread (the caller is thread 0) recomputes dist for its
+// own slice of destinations from the previous round's distances (double
+// buffer), so writes never race and the result does not depend on the
+// thread count. Slices are balanced by in-edge count. A round that relaxes
+// nothing ends the search early, as in bellman_ford, and the final
+// negative-cycle check is the same edge scan.
+// Rounds read the previous round only, so round k knows every path of at
+// most k edges: never more than n - 1 rounds when there is no negative
+// cycle, though sometimes more than the in-place sequential version.
+BellmanFordResult bellman_ford_parallel(const EdgeSoA& g,
+                                        int source,
+                                        int num_threads = static_cast<int>(std::thread::hardware_concurrency())) {
+    constexpr long long INF = std::numeric_limits<long long>::max() / 4;
+    const int n = g.n;
+    const int T = std::max(1, num_threads);
+
+    BellmanFordResult res;
+    res.dist.assign(n, INF);
+    res.parent.assign(n, -1);
+    res.has_negative_cycle = false;
+
+    res.dist[source] = 0;
+    std::vector<long long> next(res.dist);
+
+    // Thread t owns destinations [first[t], first[t + 1])
+    std::vector<int> first(T + 1, n);
+    const long long m = g.offset[n];
+    for (int t = 0; t < T; ++t) {
+        long long goal = m * t / T;
+        first[t] = static_cast<int>(std::lower_bound(g.offset.begin(), g.offset.end() - 1, goal)
+                                    - g.offset.begin());
+    }
+    first[0] = 0;
+
+    std::vector<char> relaxed(T, 0);
+    long long* cur = res.dist.data();
+    long long* nxt = next.data();
+    int round = 0;
+    bool done = n <= 1;
+
+    // Serial bookkeeping, run by the last thread to reach the barrier
+    auto on_round_end = [&]() noexcept {
+        std::swap(cur, nxt);
+        bool any_relaxed = std::any_of(relaxed.begin(), relaxed.end(), [](char r) { return r; });
+        done = !any_relaxed || ++round == n - 1;
+    };
+    std::barrier sync(T, on_round_end);
+
+    auto worker = [&](int t) {
+        while (!done) {
+            bool any_relaxed = false;
+            for (int v = first[t]; v < first[t + 1]; ++v) {
+                long long best = cur[v];
+                int best_edge = -1;
+                best_in_edge(cur, g, g.offset[v], g.offset[v + 1], best, best_edge);
+                nxt[v] = best;
+                if (best_edge != -1) {
+                    res.parent[v] = g.from[best_edge];
+                    any_relaxed = true;
+                }
+            }
+            relaxed[t] = any_relaxed;
+            sync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(T - 1);
+    for (int t = 1; t < T; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (std::thread& th : pool) {
+        th.join();
+    }
+
+    if (cur != res.dist.data()) {
+        res.dist.swap(next);
+    }
+
+    // Negative-cycle check: can any edge still relax?
+    finish_negative_cycles(res, [&](auto&& f) {
+        for (int v = 0; v < n; ++v) {
+            for (int e = g.offset[v]; e < g.offset[v + 1]; ++e) {
+                f(g.from[e], v, g.weight[e]);
+            }
+        }
+    });
+
     return res;
 }
 
@@ -98,8 +640,14 @@ std::vector<int> build_path_to_vertex(const std::vector<int>& parent,
         return {};
     }
 
+    // A simple path has at most n vertices; more steps means the parent
+    // chain is stuck in a (negative) cycle that never reaches the source
+    const int n = static_cast<int>(parent.size());
     int current = target;
     while (current != -1 && current != source) {
+        if (static_cast<int>(path.size()) == n) {
+            return {};
+        }
         path.push_back(current);
         current = parent[current];
     }
@@ -137,6 +685,21 @@ std::vector<std::vector<int>> build_all_shortest_paths(int n,
     return all_paths;
 }
 
+// Same, from a full result: vertices whose distance is -infinity (or that
+// are unreachable) get an empty path without touching the parent chain.
+std::vector<std::vector<int>> build_all_shortest_paths(const BellmanFordResult& res, int source) {
+    constexpr long long INF = std::numeric_limits<long long>::max() / 4;
+    const int n = static_cast<int>(res.dist.size());
+
+    std::vector<std::vector<int>> all_paths(n);
+    for (int v = 0; v < n; ++v) {
+        if (res.dist[v] != INF && !res.minus_inf[v]) {
+            all_paths[v] = build_path_to_vertex(res.parent, source, v);
+        }
+    }
+    return all_paths;
+}
+
 #include <iostream>
 
 int main() {
@@ -155,17 +718,44 @@ int main() {
     };
 
     int source = 0;
-    BellmanFordResult res = bellman_ford(n, edges, source);
+    BellmanFordResult res = bellman_ford(to_csr(n, edges), source);
 
     if (res.has_negative_cycle) {
-        std::cout << "Warning: negative-weight cycle reachable from source\n";
+        std::cout << "Warning: negative-weight cycle reachable from source:";
+        for (int v : res.negative_cycle) {
+            std::cout << ' ' << v;
+        }
+        std::cout << '\n';
     }
 
-    const auto all_paths = build_all_shortest_paths(n, source, res.parent);
+    // Same -infinity set, same finite distances
+    auto agrees = [&](const BellmanFordResult& other) {
+        if (other.minus_inf != res.minus_inf) {
+            return false;
+        }
+        for (int v = 0; v < n; ++v) {
+            if (!res.minus_inf[v] && other.dist[v] != res.dist[v]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Same search, relaxing destinations in parallel over the SoA layout
+    BellmanFordResult par = bellman_ford_parallel(to_soa_by_destination(n, edges), source, 4);
+    std::cout << "Parallel Bellman-Ford agrees: " << (agrees(par) ? "yes" : "no") << '\n';
+
+    // Queue-driven SPFA on the same CSR graph
+    BellmanFordResult queued = spfa(to_csr(n, edges), source);
+    std::cout << "SPFA agrees: " << (agrees(queued) ? "yes" : "no") << '\n';
+
+    const auto all_paths = build_all_shortest_paths(res, source);
 
     for (int v = 0; v < n; ++v) {
         std::cout << "Vertex " << v << ": dist = ";
-        if (res.dist[v] == std::numeric_limits<long long>::max() / 4) {
+        if (res.minus_inf[v]) {
+            std::cout << "-INF";
+        } else if (res.dist[v] == std::numeric_limits<long long>::max() / 4) {
             std::cout << "INF";
         } else {
             std::cout << res.dist[v];
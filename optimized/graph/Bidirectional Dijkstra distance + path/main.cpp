@@ -0,0 +1,310 @@
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <algorithm>
+
+// Compressed Sparse Row (CSR) graph, same layout as CSR Graph/main.cpp.
+// The out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+// Three flat arrays instead of one heap allocation per vertex.
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Reverse every edge (u -> v becomes v -> u) for the backward search
+template <typename W>
+CSRGraph<W> transpose(const CSRGraph<W> &g)
+{
+    CSRBuilder<W> builder(g.n, !g.weight.empty());
+    builder.reserve(g.num_edges());
+    for (int u = 0; u < g.n; ++u) {
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            builder.add_edge(g.target[e], u, g.weight.empty() ? W{} : g.weight[e]);
+        }
+    }
+    return builder.build();
+}
+
+struct PointToPointResult {
+    long long distance;       // INF if target is unreachable
+    std::vector<int> path;    // [source, ..., target], empty if unreachable
+    bool found;
+};
+
+// Two-sided query workspace with generation-counter (timestamp) invalidation,
+// as SearchWorkspace in Dijkstra/main.cpp. Index 0 = forward search, 1 =
+// backward search. stamp[side][v] == generation means dist/parent of v on
+// that side belong to the current query, so starting a query is a single
+// increment and a query costs O(explored region) instead of O(n).
+struct BidirectionalWorkspace {
+    std::vector<long long> dist[2];
+    std::vector<int> parent[2];
+    std::vector<unsigned> stamp[2];
+    unsigned generation = 0;
+    std::vector<std::pair<long long, int>> heap[2];   // binary heaps, capacity reused
+
+    explicit BidirectionalWorkspace(int n)
+    {
+        for (int side = 0; side < 2; ++side) {
+            dist[side].resize(n);
+            parent[side].resize(n);
+            stamp[side].assign(n, 0);
+        }
+    }
+
+    void next_query()
+    {
+        heap[0].clear();
+        heap[1].clear();
+        if (++generation == 0) {   // wrapped around: invalidate everything once
+            std::fill(stamp[0].begin(), stamp[0].end(), 0);
+            std::fill(stamp[1].begin(), stamp[1].end(), 0);
+            generation = 1;
+        }
+    }
+
+    long long distance(int side, int v) const
+    {
+        return stamp[side][v] == generation ? dist[side][v] : std::numeric_limits<long long>::max() / 4;
+    }
+
+    int parent_of(int side, int v) const { return stamp[side][v] == generation ? parent[side][v] : -1; }
+
+    void set(int side, int v, long long d, int p)
+    {
+        stamp[side][v] = generation;
+        dist[side][v] = d;
+        parent[side][v] = p;
+    }
+};
+
+// Bidirectional Dijkstra for a single (source, target) query.
+// A forward search on g from source and a backward search on the reverse
+// graph rg from target are advanced alternately, one settled vertex at a
+// time. mu is the best source -> target distance seen so far through a
+// vertex reached by both searches; once top_forward + top_backward >= mu no
+// shorter path can exist and we stop. The path is stitched together at the
+// meeting vertex from both parent arrays.
+PointToPointResult bidirectional_dijkstra(const CSRGraph<long long> &g,
+                                          const CSRGraph<long long> &rg,
+                                          int source,
+                                          int target,
+                                          BidirectionalWorkspace &ws)
+{
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+    const auto later = std::greater<>();
+    ws.next_query();
+
+    const CSRGraph<long long> *graph[2] = {&g, &rg};
+
+    ws.set(0, source, 0, -1);
+    ws.set(1, target, 0, -1);
+    ws.heap[0].push_back({0, source});
+    ws.heap[1].push_back({0, target});
+
+    long long mu = source == target ? 0 : INF;
+    int meet = source == target ? source : -1;
+
+    for (int side = 0; !ws.heap[0].empty() && !ws.heap[1].empty(); side ^= 1) {
+        if (ws.heap[0].front().first + ws.heap[1].front().first >= mu) {
+            break;
+        }
+
+        std::vector<std::pair<long long, int>> &heap = ws.heap[side];
+        std::pop_heap(heap.begin(), heap.end(), later);
+        auto [d, u] = heap.back();
+        heap.pop_back();
+
+        // If this is an outdated entry, skip it
+        if (d != ws.dist[side][u]) {
+            continue;
+        }
+
+        const CSRGraph<long long> &h = *graph[side];
+
+        for (int e = h.offset[u]; e < h.offset[u + 1]; ++e) {
+            int v = h.target[e];
+            long long nd = d + h.weight[e];
+            if (nd < ws.distance(side, v)) {
+                ws.set(side, v, nd, u);
+                heap.push_back({nd, v});
+                std::push_heap(heap.begin(), heap.end(), later);
+            }
+            // Candidate path source -> ... -> v -> ... -> target
+            long long other = ws.distance(side ^ 1, v);
+            if (other < INF && ws.distance(side, v) + other < mu) {
+                mu = ws.distance(side, v) + other;
+                meet = v;
+            }
+        }
+    }
+
+    PointToPointResult result;
+    if (meet == -1) {
+        result.distance = INF;
+        result.found = false;
+        return result; // result.path stays empty
+    }
+
+    // source -> meet from the forward tree, then meet -> target from the backward tree
+    std::vector<int> path;
+    for (int cur = meet; cur != -1; cur = ws.parent_of(0, cur)) {
+        path.push_back(cur);
+    }
+    std::reverse(path.begin(), path.end());
+    for (int cur = ws.parent_of(1, meet); cur != -1; cur = ws.parent_of(1, cur)) {
+        path.push_back(cur);
+    }
+
+    result.distance = mu;
+    result.path = std::move(path);
+    result.found = true;
+    return result;
+}
+
+// One-off query: builds a fresh workspace (O(n)); reuse one for many queries
+PointToPointResult bidirectional_dijkstra(const CSRGraph<long long> &g,
+                                          const CSRGraph<long long> &rg,
+                                          int source,
+                                          int target)
+{
+    BidirectionalWorkspace ws(g.n);
+    return bidirectional_dijkstra(g, rg, source, target, ws);
+}
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    CSRBuilder<long long> builder(n);
+    builder.reserve(m);
+
+    // Read m directed edges (u, v, w)
+    for (int i = 0; i < m; ++i) {
+        int u, v;
+        long long w;
+        std::cin >> u >> v >> w;
+        builder.add_edge(u, v, w);
+    }
+
+    CSRGraph<long long> g = builder.build();
+    CSRGraph<long long> rg = transpose(g);   // build once, reuse for every query
+    BidirectionalWorkspace ws(n);            // likewise: queries only touch what they explore
+
+    int q;
+    std::cin >> q;
+
+    // Answer q point-to-point queries (source, target)
+    while (q--) {
+        int source, target;
+        std::cin >> source >> target;
+
+        PointToPointResult res = bidirectional_dijkstra(g, rg, source, target, ws);
+
+        if (!res.found) {
+            std::cout << "Unreachable\n";
+            continue;
+        }
+
+        std::cout << "Shortest road from " << source << " to " << target
+                  << " (distance " << res.distance << ") is: ";
+        for (std::size_t i = 0; i < res.path.size(); ++i) {
+            std::cout << res.path[i] << (i + 1 < res.path.size() ? ' ' : '\n');
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+Example input (copy-paste when running):
+
+5 6
+0 1 2
+0 2 5
+1 2 1
+1 3 2
+2 3 3
+3 4 1
+3
+0 4
+2 4
+4 0
+
+Meaning:
+- 5 vertices (0..4), 6 directed edges (u, v, w) as in the Dijkstra template
+- 3 queries: 0 -> 4, 2 -> 4, 4 -> 0 (the last one is unreachable)
+*/
@@ -0,0 +1,179 @@
+#include <iostream>
+#include <vector>
+#include <utility>
+
+// ------------------------------------------------------------
+// Compressed Sparse Row (CSR) graph
+// ------------------------------------------------------------
+// The out-edges of u are target[offset[u] .. offset[u + 1]),
+// with the matching weights in weight[] (left empty for
+// unweighted graphs). Three flat arrays instead of one heap
+// allocation per vertex, so a scan over a vertex's neighbours
+// is a scan over contiguous memory.
+// ------------------------------------------------------------
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// ------------------------------------------------------------
+// CSR builder
+// ------------------------------------------------------------
+// Accepts directed edges (u, v, w) in any order, exactly as they
+// are read from the input, and groups them by source with a
+// stable counting sort in O(n + m). Edges keep their insertion
+// order inside each vertex, so algorithms visit neighbours in
+// the same order as with the vector-of-vectors adjacency list.
+// ------------------------------------------------------------
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Reverse every edge (u -> v becomes v -> u), e.g. for backward searches.
+template <typename W>
+CSRGraph<W> transpose(const CSRGraph<W>& g)
+{
+    CSRBuilder<W> builder(g.n, !g.weight.empty());
+    builder.reserve(g.num_edges());
+    for (int u = 0; u < g.n; ++u) {
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            builder.add_edge(g.target[e], u, g.weight.empty() ? W{} : g.weight[e]);
+        }
+    }
+    return builder.build();
+}
+
+// Conversions from the adjacency lists used by the other templates.
+CSRGraph<int> to_csr(const std::vector<std::vector<int>>& graph)
+{
+    const int n = static_cast<int>(graph.size());
+    CSRBuilder<int> builder(n, false);
+    for (int u = 0; u < n; ++u) {
+        for (int v : graph[u]) {
+            builder.add_edge(u, v);
+        }
+    }
+    return builder.build();
+}
+
+template <typename W>
+CSRGraph<W> to_csr(const std::vector<std::vector<std::pair<int, W>>>& adj)
+{
+    const int n = static_cast<int>(adj.size());
+    CSRBuilder<W> builder(n);
+    for (int u = 0; u < n; ++u) {
+        for (const auto& [v, w] : adj[u]) {
+            builder.add_edge(u, v, w);
+        }
+    }
+    return builder.build();
+}
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    // Read m directed edges (u, v, w) straight into the builder
+    CSRBuilder<long long> builder(n);
+    builder.reserve(m);
+    for (int i = 0; i < m; ++i) {
+        int u, v;
+        long long w;
+        std::cin >> u >> v >> w;
+        builder.add_edge(u, v, w);
+    }
+
+    CSRGraph<long long> g = builder.build();
+
+    for (int u = 0; u < g.n; ++u) {
+        std::cout << u << ":";
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            std::cout << " (" << g.target[e] << ", " << g.weight[e] << ")";
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
+
+
+/*
+Example input (copy-paste when running):
+
+5 6
+0 1 2
+0 2 5
+1 2 1
+1 3 2
+2 3 3
+3 4 1
+
+Meaning:
+- 5 vertices (0..4), 6 edges
+- Output lists the out-edges (target, weight) of every vertex
+*/
@@ -0,0 +1,655 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+
+// Compressed Sparse Row (CSR) graph, same layout as CSR Graph/main.cpp.
+// The out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+// Three flat arrays instead of one heap allocation per vertex.
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Contraction Hierarchies (Geisberger et al.) for many point-to-point queries
+// on a static graph with non-negative weights.
+//
+// Preprocessing contracts vertices one by one in order of importance. When v
+// is contracted, every pair u -> v -> w of still uncontracted neighbours gets
+// a shortcut u -> w (weight d(u,v) + d(v,w), middle vertex v) unless a local
+// "witness" Dijkstra from u that avoids v finds a path that is not longer.
+// rank[v] is the contraction order. A query then only needs two upward
+// searches (to higher rank) from source and target, which settle a tiny part
+// of the graph, and shortcuts are unpacked recursively through their middle.
+
+struct ContractionHierarchy {
+    int n = 0;
+    std::vector<int> rank;            // contraction order of every vertex
+    CSRGraph<long long> up;           // arcs u -> x with rank[x] > rank[u]
+    CSRGraph<long long> down;         // at u: arcs x -> u with rank[x] > rank[u], target = x
+    std::vector<int> up_middle;       // middle vertex of each shortcut, -1 for original arcs
+    std::vector<int> down_middle;
+};
+
+struct CHParams {
+    int witness_settle_limit = 500;   // cap on settled vertices per witness search
+    int priority_settle_limit = 50;   // same cap when only estimating priorities
+};
+
+struct CHArc {
+    int to;
+    long long w;
+    int middle;
+};
+
+// Mutable graph used during contraction
+struct CHBuilder {
+    int n;
+    std::vector<std::vector<CHArc>> out;    // out[u] = arcs u -> to
+    std::vector<std::vector<CHArc>> in;     // in[v]  = arcs from -> v (CHArc::to = from)
+    std::vector<bool> contracted;
+    std::vector<int> deleted_neighbours;
+    std::vector<std::vector<CHArc>> up;     // out-arcs of v frozen when v is contracted
+    std::vector<std::vector<CHArc>> down;   // in-arcs of v frozen when v is contracted
+
+    // Witness search scratch, reset through a generation stamp
+    std::vector<long long> wdist;
+    std::vector<int> wstamp;
+    std::vector<int> wtarget;            // == generation for out-neighbours of skip
+    int generation = 0;
+    std::vector<std::pair<long long, int>> wheap;   // binary heap, capacity reused
+
+    explicit CHBuilder(const CSRGraph<long long> &g)
+        : n(g.n), out(g.n), in(g.n), contracted(g.n, false), deleted_neighbours(g.n, 0),
+          up(g.n), down(g.n), wdist(g.n), wstamp(g.n, 0), wtarget(g.n, 0)
+    {
+        for (int u = 0; u < n; ++u) {
+            for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+                if (g.target[e] != u) {
+                    out[u].push_back({g.target[e], g.weight[e], -1});
+                }
+            }
+            // Keep only the lightest of parallel arcs
+            std::sort(out[u].begin(), out[u].end(), [](const CHArc &a, const CHArc &b) {
+                return a.to != b.to ? a.to < b.to : a.w < b.w;
+            });
+            out[u].erase(std::unique(out[u].begin(), out[u].end(), [](const CHArc &a, const CHArc &b) {
+                return a.to == b.to;
+            }), out[u].end());
+            for (const CHArc &a : out[u]) {
+                in[a.to].push_back({u, a.w, -1});
+            }
+        }
+    }
+
+    static void upsert(std::vector<CHArc> &arcs, int to, long long w, int middle)
+    {
+        for (CHArc &a : arcs) {
+            if (a.to == to) {
+                if (w < a.w) {
+                    a.w = w;
+                    a.middle = middle;
+                }
+                return;
+            }
+        }
+        arcs.push_back({to, w, middle});
+    }
+
+    long long witness_dist(int v) const
+    {
+        return wstamp[v] == generation ? wdist[v] : std::numeric_limits<long long>::max();
+    }
+
+    // Dijkstra from source over the remaining graph, never entering skip,
+    // stopping beyond limit, once every out-neighbour of skip is settled,
+    // or after settle_limit settled vertices.
+    void witness_search(int source, int skip, long long limit, int settle_limit)
+    {
+        ++generation;
+
+        int remaining = 0;
+        for (const CHArc &b : out[skip]) {
+            if (b.to != source) {
+                wtarget[b.to] = generation;
+                ++remaining;
+            }
+        }
+
+        const auto later = std::greater<>();
+        wheap.clear();
+        wdist[source] = 0;
+        wstamp[source] = generation;
+        wheap.push_back({0, source});
+
+        int settled = 0;
+        while (!wheap.empty() && remaining > 0 && settled < settle_limit) {
+            std::pop_heap(wheap.begin(), wheap.end(), later);
+            auto [d, u] = wheap.back();
+            wheap.pop_back();
+            if (d != witness_dist(u)) {
+                continue;
+            }
+            if (d > limit) {
+                break;
+            }
+            ++settled;
+            if (wtarget[u] == generation) {
+                --remaining;
+            }
+            for (const CHArc &a : out[u]) {
+                if (a.to == skip) {
+                    continue;
+                }
+                long long nd = d + a.w;
+                if (nd < witness_dist(a.to)) {
+                    wdist[a.to] = nd;
+                    wstamp[a.to] = generation;
+                    wheap.push_back({nd, a.to});
+                    std::push_heap(wheap.begin(), wheap.end(), later);
+                }
+            }
+        }
+    }
+
+    // Count (and if apply, insert) the shortcuts needed to contract v
+    int contract(int v, bool apply, int settle_limit)
+    {
+        int shortcuts = 0;
+        for (const CHArc &a : in[v]) {
+            int u = a.to;
+
+            long long limit = 0;
+            for (const CHArc &b : out[v]) {
+                if (b.to != u) {
+                    limit = std::max(limit, a.w + b.w);
+                }
+            }
+            witness_search(u, v, limit, settle_limit);
+
+            for (const CHArc &b : out[v]) {
+                int w = b.to;
+                if (w == u) {
+                    continue;
+                }
+                long long via = a.w + b.w;
+                if (witness_dist(w) > via) {
+                    ++shortcuts;
+                    if (apply) {
+                        upsert(out[u], w, via, v);
+                        upsert(in[w], u, via, v);
+                    }
+                }
+            }
+        }
+        return shortcuts;
+    }
+
+    // Edge difference + deleted neighbours: lower = contract earlier
+    int priority(int v, int settle_limit)
+    {
+        int degree = static_cast<int>(in[v].size() + out[v].size());
+        return contract(v, false, settle_limit) - degree + deleted_neighbours[v];
+    }
+
+    // Contract v for real: its remaining arcs all lead to higher ranks, so
+    // they become its upward arcs, and v is unlinked from its neighbours
+    // to keep later witness searches and degree counts small.
+    void remove(int v, int settle_limit)
+    {
+        contract(v, true, settle_limit);
+        contracted[v] = true;
+
+        auto unlink = [v](std::vector<CHArc> &arcs) {
+            arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [v](const CHArc &a) {
+                return a.to == v;
+            }), arcs.end());
+        };
+        for (const CHArc &a : in[v]) {
+            unlink(out[a.to]);
+            ++deleted_neighbours[a.to];
+        }
+        for (const CHArc &a : out[v]) {
+            unlink(in[a.to]);
+            ++deleted_neighbours[a.to];
+        }
+
+        up[v] = std::move(out[v]);
+        down[v] = std::move(in[v]);
+        out[v].clear();
+        in[v].clear();
+    }
+};
+
+// Flatten per-vertex arc lists into a CSR graph plus a middle array
+void flatten_arcs(const std::vector<std::vector<CHArc>> &lists,
+                  CSRGraph<long long> &g,
+                  std::vector<int> &middle)
+{
+    const int n = static_cast<int>(lists.size());
+    g.n = n;
+    g.offset.assign(n + 1, 0);
+    for (int u = 0; u < n; ++u) {
+        g.offset[u + 1] = g.offset[u] + static_cast<int>(lists[u].size());
+    }
+    g.target.resize(g.offset[n]);
+    g.weight.resize(g.offset[n]);
+    middle.resize(g.offset[n]);
+    for (int u = 0; u < n; ++u) {
+        int e = g.offset[u];
+        for (const CHArc &a : lists[u]) {
+            g.target[e] = a.to;
+            g.weight[e] = a.w;
+            middle[e] = a.middle;
+            ++e;
+        }
+    }
+}
+
+// Node ordering (lazy updates on the priority) + contraction
+ContractionHierarchy build_contraction_hierarchy(const CSRGraph<long long> &g,
+                                                 CHParams params = {})
+{
+    const int n = g.n;
+    CHBuilder b(g);
+
+    using Entry = std::pair<int, int>;   // (priority, vertex)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> order;
+    std::vector<int> current(n);         // latest priority; older entries are stale
+    for (int v = 0; v < n; ++v) {
+        current[v] = b.priority(v, params.priority_settle_limit);
+        order.push({current[v], v});
+    }
+
+    ContractionHierarchy ch;
+    ch.n = n;
+    ch.rank.assign(n, -1);
+
+    int next_rank = 0;
+    while (!order.empty()) {
+        auto [p, v] = order.top();
+        order.pop();
+        if (b.contracted[v] || p != current[v]) {
+            continue;
+        }
+
+        // Lazy update: the priority may have grown since it was computed
+        current[v] = b.priority(v, params.priority_settle_limit);
+        if (!order.empty() && current[v] > order.top().first) {
+            order.push({current[v], v});
+            continue;
+        }
+
+        b.remove(v, params.witness_settle_limit);
+        ch.rank[v] = next_rank++;
+    }
+
+    flatten_arcs(b.up, ch.up, ch.up_middle);
+    flatten_arcs(b.down, ch.down, ch.down_middle);
+    return ch;
+}
+
+// ------------------------------------------------------------------
+// Serialization (binary; each vector is written as size + raw data)
+// ------------------------------------------------------------------
+template <typename T>
+void write_vector(std::ostream &os, const std::vector<T> &v)
+{
+    std::uint64_t size = v.size();
+    os.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    os.write(reinterpret_cast<const char *>(v.data()), static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+template <typename T>
+bool read_vector(std::istream &is, std::vector<T> &v)
+{
+    std::uint64_t size = 0;
+    if (!is.read(reinterpret_cast<char *>(&size), sizeof(size))) {
+        return false;
+    }
+    v.resize(size);
+    return static_cast<bool>(is.read(reinterpret_cast<char *>(v.data()), static_cast<std::streamsize>(size * sizeof(T))));
+}
+
+void save_hierarchy(const ContractionHierarchy &ch, std::ostream &os)
+{
+    os.write(reinterpret_cast<const char *>(&ch.n), sizeof(ch.n));
+    write_vector(os, ch.rank);
+    write_vector(os, ch.up.offset);
+    write_vector(os, ch.up.target);
+    write_vector(os, ch.up.weight);
+    write_vector(os, ch.up_middle);
+    write_vector(os, ch.down.offset);
+    write_vector(os, ch.down.target);
+    write_vector(os, ch.down.weight);
+    write_vector(os, ch.down_middle);
+}
+
+// Returns false if the stream ends early; ch is then left incomplete
+bool load_hierarchy(std::istream &is, ContractionHierarchy &ch)
+{
+    if (!is.read(reinterpret_cast<char *>(&ch.n), sizeof(ch.n))) {
+        return false;
+    }
+    ch.up.n = ch.n;
+    ch.down.n = ch.n;
+    return read_vector(is, ch.rank)
+        && read_vector(is, ch.up.offset)
+        && read_vector(is, ch.up.target)
+        && read_vector(is, ch.up.weight)
+        && read_vector(is, ch.up_middle)
+        && read_vector(is, ch.down.offset)
+        && read_vector(is, ch.down.target)
+        && read_vector(is, ch.down.weight)
+        && read_vector(is, ch.down_middle);
+}
+
+// ------------------------------------------------------------------
+// Query engine
+// ------------------------------------------------------------------
+struct PointToPointResult {
+    long long distance;       // INF if target is unreachable
+    std::vector<int> path;    // [source, ..., target], empty if unreachable
+    bool found;
+};
+
+// Bidirectional upward Dijkstra. The scratch arrays are allocated once per
+// engine and only the touched entries are reset after each query, so a
+// query costs time proportional to the (small) upward search spaces.
+struct CHQuery {
+    const ContractionHierarchy &ch;
+    std::vector<long long> dist[2];
+    std::vector<int> parent[2];        // previous vertex in the search tree
+    std::vector<int> parent_arc[2];    // arc index in up (side 0) / down (side 1)
+    std::vector<int> touched;
+
+    explicit CHQuery(const ContractionHierarchy &ch) : ch(ch)
+    {
+        const long long INF = std::numeric_limits<long long>::max() / 4;
+        for (int side = 0; side < 2; ++side) {
+            dist[side].assign(ch.n, INF);
+            parent[side].assign(ch.n, -1);
+            parent_arc[side].assign(ch.n, -1);
+        }
+    }
+
+    // Append the original vertices of arc a -> b (excluding a) to path
+    void unpack(int a, int b, int middle, std::vector<int> &path) const
+    {
+        struct Item {
+            int a, b, middle;
+        };
+        std::vector<Item> stack{{a, b, middle}};
+        while (!stack.empty()) {
+            Item it = stack.back();
+            stack.pop_back();
+            if (it.middle == -1) {
+                path.push_back(it.b);
+                continue;
+            }
+            // a -> m lives in down[m], m -> b in up[m] (m has the lowest rank)
+            const int m = it.middle;
+            int first = -1;
+            int second = -1;
+            for (int e = ch.down.offset[m]; e < ch.down.offset[m + 1]; ++e) {
+                if (ch.down.target[e] == it.a) {
+                    first = ch.down_middle[e];
+                    break;
+                }
+            }
+            for (int e = ch.up.offset[m]; e < ch.up.offset[m + 1]; ++e) {
+                if (ch.up.target[e] == it.b) {
+                    second = ch.up_middle[e];
+                    break;
+                }
+            }
+            stack.push_back({m, it.b, second});
+            stack.push_back({it.a, m, first});
+        }
+    }
+
+    PointToPointResult run(int source, int target)
+    {
+        const long long INF = std::numeric_limits<long long>::max() / 4;
+        const CSRGraph<long long> *graph[2] = {&ch.up, &ch.down};
+
+        using Node = std::pair<long long, int>;
+        std::priority_queue<Node, std::vector<Node>, std::greater<>> pq[2];
+
+        dist[0][source] = 0;
+        dist[1][target] = 0;
+        touched.push_back(source);
+        touched.push_back(target);
+        pq[0].push({0, source});
+        pq[1].push({0, target});
+
+        long long mu = INF;
+        int meet = -1;
+
+        for (int side = 0; !pq[0].empty() || !pq[1].empty(); side ^= 1) {
+            // A side whose minimum already reaches mu cannot improve it
+            for (int s = 0; s < 2; ++s) {
+                if (!pq[s].empty() && pq[s].top().first >= mu) {
+                    pq[s] = {};
+                }
+            }
+            if (pq[side].empty()) {
+                continue;
+            }
+
+            auto [d, u] = pq[side].top();
+            pq[side].pop();
+            if (d != dist[side][u]) {
+                continue;
+            }
+
+            if (dist[side ^ 1][u] < INF && d + dist[side ^ 1][u] < mu) {
+                mu = d + dist[side ^ 1][u];
+                meet = u;
+            }
+
+            const CSRGraph<long long> &h = *graph[side];
+            for (int e = h.offset[u]; e < h.offset[u + 1]; ++e) {
+                int v = h.target[e];
+                long long nd = d + h.weight[e];
+                if (nd < dist[side][v]) {
+                    if (dist[0][v] == INF && dist[1][v] == INF) {
+                        touched.push_back(v);
+                    }
+                    dist[side][v] = nd;
+                    parent[side][v] = u;
+                    parent_arc[side][v] = e;
+                    pq[side].push({nd, v});
+                }
+            }
+        }
+
+        PointToPointResult result;
+        result.distance = INF;
+        result.found = false;
+
+        if (meet != -1) {
+            // Upward arcs source -> meet, in order
+            std::vector<int> arcs;
+            for (int cur = meet; cur != source; cur = parent[0][cur]) {
+                arcs.push_back(parent_arc[0][cur]);
+            }
+            std::reverse(arcs.begin(), arcs.end());
+
+            result.path.push_back(source);
+            int cur = source;
+            for (int e : arcs) {
+                int next = ch.up.target[e];
+                unpack(cur, next, ch.up_middle[e], result.path);
+                cur = next;
+            }
+            // Downward arcs meet -> target
+            for (cur = meet; cur != target; cur = parent[1][cur]) {
+                int e = parent_arc[1][cur];
+                unpack(cur, parent[1][cur], ch.down_middle[e], result.path);
+            }
+
+            result.distance = mu;
+            result.found = true;
+        }
+
+        for (int v : touched) {
+            for (int side = 0; side < 2; ++side) {
+                dist[side][v] = INF;
+                parent[side][v] = -1;
+                parent_arc[side][v] = -1;
+            }
+        }
+        touched.clear();
+
+        return result;
+    }
+};
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    CSRBuilder<long long> builder(n);
+    builder.reserve(m);
+
+    // Read m directed edges (u, v, w)
+    for (int i = 0; i < m; ++i) {
+        int u, v;
+        long long w;
+        std::cin >> u >> v >> w;
+        builder.add_edge(u, v, w);
+    }
+
+    ContractionHierarchy ch = build_contraction_hierarchy(builder.build());
+
+    // Round-trip through the binary format (a file in real use)
+    std::stringstream storage;
+    save_hierarchy(ch, storage);
+    ContractionHierarchy loaded;
+    if (!load_hierarchy(storage, loaded)) {
+        std::cout << "Failed to load hierarchy\n";
+        return 0;
+    }
+
+    CHQuery query(loaded);
+
+    int q;
+    std::cin >> q;
+
+    // Answer q point-to-point queries (source, target)
+    while (q--) {
+        int source, target;
+        std::cin >> source >> target;
+
+        PointToPointResult res = query.run(source, target);
+
+        if (!res.found) {
+            std::cout << "Unreachable\n";
+            continue;
+        }
+
+        std::cout << "Shortest road from " << source << " to " << target
+                  << " (distance " << res.distance << ") is: ";
+        for (std::size_t i = 0; i < res.path.size(); ++i) {
+            std::cout << res.path[i] << (i + 1 < res.path.size() ? ' ' : '\n');
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+Example input (copy-paste when running):
+
+5 6
+0 1 2
+0 2 5
+1 2 1
+1 3 2
+2 3 3
+3 4 1
+3
+0 4
+2 4
+4 0
+
+Meaning:
+- 5 vertices (0..4), 6 directed edges (u, v, w) as in the Dijkstra template
+- 3 queries: 0 -> 4, 2 -> 4, 4 -> 0 (the last one is unreachable)
+*/
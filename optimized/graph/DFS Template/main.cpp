@@ -1,32 +1,311 @@
 #include <iostream>
 #include <vector>
 
+// ------------------------------------------------------------
+// DFS visitor
+// ------------------------------------------------------------
+// The searches below are templates on the visitor type, so the
+// hooks are resolved and inlined at compile time (no virtual
+// calls). Derive from DFSVisitor and hide only the hooks you
+// need; the rest stay empty and compile away.
+//   discover_vertex(u)   u is entered (pre-order)
+//   examine_edge(u, v)   edge u -> v is scanned
+//   finish_vertex(u)     all edges of u are done (post-order)
+// ------------------------------------------------------------
+struct DFSVisitor {
+    void discover_vertex(int) {}
+    void examine_edge(int, int) {}
+    void finish_vertex(int) {}
+};
+
+// Prints every vertex as it is entered (the original template output)
+struct PrintDFSVisitor : DFSVisitor {
+    void discover_vertex(int u) { std::cout << "Visited: " << u << "\n"; }
+};
+
 // ------------------------------------------------------------
 // Depth-First Search (DFS) – recursive version
 // ------------------------------------------------------------
+template <typename Visitor>
 void DFS_Util(const std::vector<std::vector<int>>& graph,
               std::vector<bool>& visited,
-              int u)
+              int u,
+              Visitor& vis)
 {
     visited[u] = true;
-
-    // --------------------------------------------------------
-    // INSERT VERTEX PROCESSING CODE HERE
-    std::cout << "Visited: " << u << "\n";
-    // --------------------------------------------------------
+    vis.discover_vertex(u);
 
     for (int v : graph[u]) {
+        vis.examine_edge(u, v);
         if (!visited[v]) {
-            DFS_Util(graph, visited, v);
+            DFS_Util(graph, visited, v, vis);
         }
     }
+
+    vis.finish_vertex(u);
 }
 
-void DFS(const std::vector<std::vector<int>>& graph, int start)
+template <typename Visitor>
+void DFS(const std::vector<std::vector<int>>& graph, int start, Visitor&& vis)
 {
     int n = static_cast<int>(graph.size());
     std::vector<bool> visited(n, false);
-    DFS_Util(graph, visited, start);
+    DFS_Util(graph, visited, start, vis);
+}
+
+void DFS(const std::vector<std::vector<int>>& graph, int start)
+{
+    DFS(graph, start, PrintDFSVisitor{});
+}
+
+// ------------------------------------------------------------
+// Compressed Sparse Row (CSR) graph – see CSR Graph/main.cpp
+// ------------------------------------------------------------
+// The out-edges of u are target[offset[u] .. offset[u + 1]),
+// weights (if any) in weight[]. Flat arrays, no per-vertex
+// allocations, contiguous neighbour scans.
+// ------------------------------------------------------------
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+CSRGraph<int> to_csr(const std::vector<std::vector<int>>& graph)
+{
+    const int n = static_cast<int>(graph.size());
+    CSRBuilder<int> builder(n, false);
+    for (int u = 0; u < n; ++u) {
+        for (int v : graph[u]) {
+            builder.add_edge(u, v);
+        }
+    }
+    return builder.build();
+}
+
+// ------------------------------------------------------------
+// DFS over a CSR graph – same visit order as above
+// ------------------------------------------------------------
+template <typename Visitor>
+void DFS_Util(const CSRGraph<int>& graph,
+              std::vector<bool>& visited,
+              int u,
+              Visitor& vis)
+{
+    visited[u] = true;
+    vis.discover_vertex(u);
+
+    for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+        int v = graph.target[e];
+        vis.examine_edge(u, v);
+        if (!visited[v]) {
+            DFS_Util(graph, visited, v, vis);
+        }
+    }
+
+    vis.finish_vertex(u);
+}
+
+template <typename Visitor>
+void DFS(const CSRGraph<int>& graph, int start, Visitor&& vis)
+{
+    std::vector<bool> visited(graph.n, false);
+    DFS_Util(graph, visited, start, vis);
+}
+
+void DFS(const CSRGraph<int>& graph, int start)
+{
+    DFS(graph, start, PrintDFSVisitor{});
+}
+
+// ------------------------------------------------------------
+// Iterative DFS – explicit stack, no recursion depth limit
+// ------------------------------------------------------------
+// Each frame is (vertex, index of the next edge to scan), so
+// resuming a vertex continues exactly where the recursive call
+// would have returned to: pre-order and post-order are the same
+// as DFS_Util. The stack is reserved for n frames up front
+// (the deepest possible path) and never reallocates. Pass a
+// caller-owned visited/stack to reuse them across several
+// starts (e.g. a DFS forest).
+// ------------------------------------------------------------
+struct DFSFrame {
+    int u;
+    int next_edge;   // CSR: edge id; adjacency list: index into graph[u]
+};
+
+template <typename Visitor>
+void iterative_dfs(const CSRGraph<int>& graph,
+                   int start,
+                   std::vector<bool>& visited,
+                   std::vector<DFSFrame>& stack,
+                   Visitor&& vis)
+{
+    stack.clear();
+    stack.reserve(graph.n);
+
+    visited[start] = true;
+    vis.discover_vertex(start);
+    stack.push_back({start, graph.offset[start]});
+
+    while (!stack.empty()) {
+        DFSFrame& top = stack.back();
+        const int u = top.u;
+
+        if (top.next_edge == graph.offset[u + 1]) {
+            stack.pop_back();
+            vis.finish_vertex(u);
+            continue;
+        }
+
+        int v = graph.target[top.next_edge++];
+        vis.examine_edge(u, v);
+        if (!visited[v]) {
+            visited[v] = true;
+            vis.discover_vertex(v);
+            stack.push_back({v, graph.offset[v]});   // `top` is not used after this
+        }
+    }
+}
+
+template <typename Visitor>
+void iterative_dfs(const std::vector<std::vector<int>>& graph,
+                   int start,
+                   std::vector<bool>& visited,
+                   std::vector<DFSFrame>& stack,
+                   Visitor&& vis)
+{
+    stack.clear();
+    stack.reserve(graph.size());
+
+    visited[start] = true;
+    vis.discover_vertex(start);
+    stack.push_back({start, 0});
+
+    while (!stack.empty()) {
+        DFSFrame& top = stack.back();
+        const int u = top.u;
+
+        if (top.next_edge == static_cast<int>(graph[u].size())) {
+            stack.pop_back();
+            vis.finish_vertex(u);
+            continue;
+        }
+
+        int v = graph[u][top.next_edge++];
+        vis.examine_edge(u, v);
+        if (!visited[v]) {
+            visited[v] = true;
+            vis.discover_vertex(v);
+            stack.push_back({v, 0});
+        }
+    }
+}
+
+// Adapts a pair of pre-order / post-order callables to a visitor
+template <typename PreVisit, typename PostVisit>
+struct PrePostVisitor : DFSVisitor {
+    PreVisit& pre_visit;
+    PostVisit& post_visit;
+
+    PrePostVisitor(PreVisit& pre, PostVisit& post) : pre_visit(pre), post_visit(post) {}
+
+    void discover_vertex(int u) { pre_visit(u); }
+    void finish_vertex(int u) { post_visit(u); }
+};
+
+template <typename Graph, typename PreVisit, typename PostVisit>
+void iterative_dfs(const Graph& graph,
+                   int start,
+                   std::vector<bool>& visited,
+                   std::vector<DFSFrame>& stack,
+                   PreVisit&& pre_visit,
+                   PostVisit&& post_visit)
+{
+    iterative_dfs(graph, start, visited, stack, PrePostVisitor<PreVisit, PostVisit>(pre_visit, post_visit));
+}
+
+// One-off searches from a single start
+template <typename PreVisit, typename PostVisit>
+void iterative_dfs(const CSRGraph<int>& graph, int start, PreVisit&& pre_visit, PostVisit&& post_visit)
+{
+    std::vector<bool> visited(graph.n, false);
+    std::vector<DFSFrame> stack;
+    iterative_dfs(graph, start, visited, stack, pre_visit, post_visit);
+}
+
+template <typename PreVisit, typename PostVisit>
+void iterative_dfs(const std::vector<std::vector<int>>& graph, int start, PreVisit&& pre_visit, PostVisit&& post_visit)
+{
+    std::vector<bool> visited(graph.size(), false);
+    std::vector<DFSFrame> stack;
+    iterative_dfs(graph, start, visited, stack, pre_visit, post_visit);
 }
 
 int main()
@@ -48,5 +327,35 @@ int main()
     std::cout << "DFS starting from vertex " << start_vertex << ":\n";
     DFS(graph, start_vertex);
 
+    CSRGraph<int> csr = to_csr(graph);
+
+    std::cout << "DFS (CSR) starting from vertex " << start_vertex << ":\n";
+    DFS(csr, start_vertex);
+
+    std::cout << "Iterative DFS (CSR) pre-order / post-order:\n";
+    std::vector<int> pre_order, post_order;
+    iterative_dfs(csr, start_vertex,
+                  [&](int u) { pre_order.push_back(u); },
+                  [&](int u) { post_order.push_back(u); });
+    for (int u : pre_order) {
+        std::cout << u << " ";
+    }
+    std::cout << "/ ";
+    for (int u : post_order) {
+        std::cout << u << " ";
+    }
+    std::cout << "\n";
+
+    // Visitor hooks instead of printing: count tree and non-tree edges
+    struct EdgeCounter : DFSVisitor {
+        int discovered = 0;
+        int edges = 0;
+        void discover_vertex(int) { ++discovered; }
+        void examine_edge(int, int) { ++edges; }
+    } counter;
+    DFS(csr, start_vertex, counter);
+    std::cout << "Visitor: " << counter.discovered << " vertices, "
+              << counter.edges << " edges examined\n";
+
     return 0;
 }
@@ -0,0 +1,437 @@
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <barrier>
+#include <map>
+#include <thread>
+
+// Type aliases for convenience
+using AdjList = std::vector<std::vector<std::pair<int, long long>>>;
+// adj[u] contains pairs (v, w) meaning an edge u -> v with weight w
+
+// Compressed Sparse Row (CSR) graph, same layout as CSR Graph/main.cpp.
+// The out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+// Three flat arrays instead of one heap allocation per vertex.
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Convert an existing AdjList into CSR form
+CSRGraph<long long> to_csr(const AdjList &adj)
+{
+    const int n = static_cast<int>(adj.size());
+    CSRBuilder<long long> builder(n);
+    for (int u = 0; u < n; ++u) {
+        for (const auto &[v, w] : adj[u]) {
+            builder.add_edge(u, v, w);
+        }
+    }
+    return builder.build();
+}
+
+// Delta-stepping (Meyer & Sanders): parallel single-source shortest paths.
+//
+// Tentative distances are kept in buckets of width delta. The smallest
+// non-empty bucket is emptied in rounds: all its vertices relax their light
+// edges (w <= delta) in parallel, which may refill the same bucket; once it
+// stays empty, the vertices settled in it relax their heavy edges (w > delta)
+// once. delta -> 0 degenerates to Dijkstra, delta -> inf to Bellman-Ford;
+// a good start is max_weight / average_degree (used when delta <= 0).
+//
+// Parallelism without atomics: vertex v is owned by thread v % T, which is
+// the only one that writes dist[v], parent[v] and v's bucket entries. A
+// relaxation u -> v is sent as a request to v's owner through a T x T
+// outbox, and owners apply their requests after a barrier. Requests are
+// applied in a fixed order, so the output does not depend on scheduling.
+//
+// dist is identical to dijkstra(); parent is a valid shortest-path tree and
+// equals dijkstra()'s whenever shortest paths are unique.
+void delta_stepping(int source,
+                    const CSRGraph<long long> &g,
+                    std::vector<long long> &dist,
+                    std::vector<int> &parent,
+                    long long delta = 0,
+                    int num_threads = static_cast<int>(std::thread::hardware_concurrency()))
+{
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+    const int n = g.n;
+    const int T = std::max(1, num_threads);
+
+    dist.assign(n, INF);
+    parent.assign(n, -1);
+
+    long long max_weight = 0;
+    for (long long w : g.weight) {
+        max_weight = std::max(max_weight, w);
+    }
+    if (delta <= 0) {
+        long long avg_degree = std::max(1, g.num_edges() / std::max(1, n));
+        delta = std::max(1LL, max_weight / avg_degree);
+    }
+
+    // Reorder every vertex's edges as [light..., heavy...]
+    std::vector<int> target(g.target);
+    std::vector<long long> weight(g.weight);
+    std::vector<int> light_end(n);
+    for (int u = 0; u < n; ++u) {
+        int split = g.offset[u];
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            if (g.weight[e] <= delta) {
+                target[split] = g.target[e];
+                weight[split] = g.weight[e];
+                ++split;
+            }
+        }
+        light_end[u] = split;
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            if (g.weight[e] > delta) {
+                target[split] = g.target[e];
+                weight[split] = g.weight[e];
+                ++split;
+            }
+        }
+    }
+
+    struct Request {
+        int v;
+        int u;
+        long long d;
+    };
+
+    // Per owner thread: its non-empty buckets keyed by absolute index, current
+    // round, settled set. Only occupied buckets are stored, so a small delta
+    // against large weights (max_weight / delta huge) costs no memory and the
+    // next bucket is found with one begin() per thread instead of a scan.
+    std::vector<std::map<long long, std::vector<int>>> buckets(T);
+    std::vector<std::vector<int>> round(T);
+    std::vector<std::vector<int>> settled(T);
+    std::vector<std::vector<std::vector<Request>>> outbox(T, std::vector<std::vector<Request>>(T));
+    std::vector<long long> round_mark(n, -1);    // last round v was taken in
+    std::vector<long long> settled_mark(n, -1);  // last bucket v was settled in
+
+    dist[source] = 0;
+    parent[source] = -1;
+    buckets[source % T][0].push_back(source);
+
+    long long cur = 0;          // absolute index of the bucket being emptied
+    long long round_id = 0;
+    bool more_light = false;
+    bool done = false;
+
+    enum class Stage { LightRelax, LightApply, HeavyRelax, HeavyApply };
+    Stage stage = Stage::LightRelax;
+
+    auto any_in_bucket = [&](long long b) {
+        for (int t = 0; t < T; ++t) {
+            if (buckets[t].count(b) != 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Serial decisions, run by the last thread to reach each barrier
+    auto on_stage_end = [&]() noexcept {
+        switch (stage) {
+        case Stage::LightRelax:
+            stage = Stage::LightApply;
+            break;
+        case Stage::LightApply:
+            ++round_id;
+            more_light = any_in_bucket(cur);
+            stage = more_light ? Stage::LightRelax : Stage::HeavyRelax;
+            break;
+        case Stage::HeavyRelax:
+            stage = Stage::HeavyApply;
+            break;
+        case Stage::HeavyApply:
+            // Every bucket <= cur has been taken and erased
+            done = true;
+            for (int t = 0; t < T; ++t) {
+                if (!buckets[t].empty() && (done || buckets[t].begin()->first < cur)) {
+                    cur = buckets[t].begin()->first;
+                    done = false;
+                }
+            }
+            stage = Stage::LightRelax;
+            break;
+        }
+    };
+    std::barrier sync(T, on_stage_end);
+
+    auto relax = [&](int t, int u, int begin, int end) {
+        for (int e = begin; e < end; ++e) {
+            int v = target[e];
+            long long nd = dist[u] + weight[e];
+            if (nd < dist[v]) {
+                outbox[t][v % T].push_back({v, u, nd});
+            }
+        }
+    };
+
+    auto apply = [&](int t) {
+        for (int from = 0; from < T; ++from) {
+            for (const Request &r : outbox[from][t]) {
+                if (r.d < dist[r.v]) {
+                    dist[r.v] = r.d;
+                    parent[r.v] = r.u;
+                    buckets[t][r.d / delta].push_back(r.v);
+                }
+            }
+            outbox[from][t].clear();
+        }
+    };
+
+    auto worker = [&](int t) {
+        while (!done) {
+            settled[t].clear();
+
+            do {
+                // Take this thread's live, not yet taken entries of bucket cur
+                round[t].clear();
+                auto it = buckets[t].find(cur);
+                if (it != buckets[t].end()) {
+                    for (int v : it->second) {
+                        if (dist[v] / delta == cur && round_mark[v] != round_id) {
+                            round_mark[v] = round_id;
+                            round[t].push_back(v);
+                            if (settled_mark[v] != cur) {
+                                settled_mark[v] = cur;
+                                settled[t].push_back(v);
+                            }
+                        }
+                    }
+                    buckets[t].erase(it);
+                }
+
+                for (int u : round[t]) {
+                    relax(t, u, g.offset[u], light_end[u]);
+                }
+                sync.arrive_and_wait();
+
+                apply(t);
+                sync.arrive_and_wait();
+            } while (more_light);
+
+            for (int u : settled[t]) {
+                relax(t, u, light_end[u], g.offset[u + 1]);
+            }
+            sync.arrive_and_wait();
+
+            apply(t);
+            sync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(T - 1);
+    for (int t = 1; t < T; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (std::thread &th : pool) {
+        th.join();
+    }
+}
+
+// Same entry point for the AdjList input used by the Dijkstra template
+void delta_stepping([[maybe_unused]] int n,
+                    int source,
+                    const AdjList &adj,
+                    std::vector<long long> &dist,
+                    std::vector<int> &parent,
+                    long long delta = 0,
+                    int num_threads = static_cast<int>(std::thread::hardware_concurrency()))
+{
+    delta_stepping(source, to_csr(adj), dist, parent, delta, num_threads);
+}
+
+// Build all shortest paths from the source using the parent array.
+// Returns a vector of paths, where paths[v] is the path from source to v.
+// If v is unreachable, paths[v] will be an empty vector.
+std::vector<std::vector<int>> build_all_paths(int source,
+                                              const std::vector<int> &parent)
+{
+    int n = static_cast<int>(parent.size());
+    std::vector<std::vector<int>> paths(n);
+
+    for (int v = 0; v < n; ++v) {
+        if (v == source) {
+            paths[v] = {source};
+            continue;
+        }
+
+        // Reconstruct by walking backwards from v to source using parent[]
+        std::vector<int> path;
+        int current = v;
+
+        // If parent[current] == -1 and current != source, it may be unreachable.
+        // We detect reachability by seeing whether we eventually get to source.
+        while (current != -1) {
+            path.push_back(current);
+            if (current == source) {
+                break;
+            }
+            current = parent[current];
+        }
+
+        if (!path.empty() && path.back() == source) {
+            // We reconstructed source -> ... -> v in reverse; fix the order
+            std::reverse(path.begin(), path.end());
+            paths[v] = std::move(path);
+        } else {
+            // Unreachable: leave paths[v] empty
+            paths[v].clear();
+        }
+    }
+
+    return paths;
+}
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    AdjList adj(n);
+
+    // Read m directed edges (u, v, w)
+    for (int i = 0; i < m; ++i) {
+        int u, v;
+        long long w;
+        std::cin >> u >> v >> w;
+        adj[u].push_back({v, w});
+    }
+
+    int source;
+    std::cin >> source;
+
+    std::vector<long long> dist;
+    std::vector<int> parent;
+
+    // delta = 0 picks max_weight / average_degree; all hardware threads
+    delta_stepping(n, source, adj, dist, parent);
+    auto paths = build_all_paths(source, parent);
+
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+
+    // Output distances
+    for (int v = 0; v < n; ++v) {
+        if (dist[v] >= INF) {
+            std::cout << "INF\n";
+        } else {
+            std::cout << "Distance from " << source << " to " << v << " is: " << dist[v] << "\n";
+        }
+    }
+
+    // Output shortest paths
+    for (int v = 0; v < n; ++v) {
+        if (paths[v].empty()) {
+            std::cout << "Unreachable\n";
+        } else {
+            std::cout << "Shortest road from " << source << " to " << v << " is: ";
+            for (std::size_t i = 0; i < paths[v].size(); ++i) {
+                std::cout << paths[v][i] << (i + 1 < paths[v].size() ? ' ' : '\n');
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+Example input (copy-paste when running):
+
+5 6
+0 1 2
+0 2 5
+1 2 1
+1 3 2
+2 3 3
+3 4 1
+0
+
+Meaning:
+- 5 vertices (0..4), 6 edges
+- Edges:
+  0 -> 1 (weight 2)
+  0 -> 2 (weight 5)
+  1 -> 2 (weight 1)
+  1 -> 3 (weight 2)
+  2 -> 3 (weight 3)
+  3 -> 4 (weight 1)
+- Source vertex: 0
+*/
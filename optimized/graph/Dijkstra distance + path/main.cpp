@@ -3,12 +3,221 @@
 #include <queue>
 #include <limits>
 #include <algorithm>
+#include <bit>
 
 // Type aliases for convenience
 using AdjList = std::vector<std::vector<std::pair<int, long long>>>;
 // adj[u] contains pairs (v, w) meaning an edge u -> v with weight w
 
+// Monotone priority queues for Dijkstra, chosen at compile time via the
+// PQ template parameter of dijkstra(). All of them hold (distance, vertex)
+// entries with lazy deletion and share the same interface:
+//   PQ pq(max_weight); pq.push(d, v); pq.empty(); auto [d, v] = pq.pop();
+// needs_max_weight tells dijkstra() whether to scan the weights first.
+
+// Binary heap (std::priority_queue) - the default, O(log m) per operation
+struct BinaryHeapQueue {
+    static constexpr bool needs_max_weight = false;
+
+    using Node = std::pair<long long, int>;
+    std::priority_queue<Node, std::vector<Node>, std::greater<>> pq;
+
+    explicit BinaryHeapQueue(long long /*max_weight*/ = 0) {}
+
+    bool empty() const { return pq.empty(); }
+    void push(long long d, int v) { pq.push({d, v}); }
+    Node pop()
+    {
+        Node top = pq.top();
+        pq.pop();
+        return top;
+    }
+};
+
+// Radix heap: keys are only ever >= the last popped key (true for Dijkstra
+// with non-negative weights). Bucket i holds keys whose highest bit that
+// differs from the last popped key is bit i - 1, so every entry moves down
+// at most 64 times in total: O(log C) amortized, and sequential bucket
+// scans instead of heap sifts.
+struct RadixHeapQueue {
+    static constexpr bool needs_max_weight = false;
+
+    using Node = std::pair<long long, int>;
+    std::vector<Node> buckets[65];
+    unsigned long long last = 0;
+    std::size_t count = 0;
+
+    explicit RadixHeapQueue(long long /*max_weight*/ = 0) {}
+
+    static int bucket_of(unsigned long long key, unsigned long long last)
+    {
+        return key == last ? 0 : 64 - std::countl_zero(key ^ last);
+    }
+
+    bool empty() const { return count == 0; }
+
+    void push(long long d, int v)
+    {
+        buckets[bucket_of(d, last)].push_back({d, v});
+        ++count;
+    }
+
+    Node pop()
+    {
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty()) {
+                ++i;
+            }
+            // New minimum becomes "last"; redistribute bucket i into lower buckets
+            last = std::min_element(buckets[i].begin(), buckets[i].end())->first;
+            for (const Node &node : buckets[i]) {
+                buckets[bucket_of(node.first, last)].push_back(node);
+            }
+            buckets[i].clear();
+        }
+        Node top = buckets[0].back();
+        buckets[0].pop_back();
+        --count;
+        return top;
+    }
+};
+
+// Dial's bucket queue for a small maximum edge weight C: live keys always lie
+// in [current, current + C], so C + 1 circular buckets suffice. O(1) push,
+// pop is O(1) amortized plus O(C) per distinct distance gap.
+struct DialQueue {
+    static constexpr bool needs_max_weight = true;
+
+    using Node = std::pair<long long, int>;
+    std::vector<std::vector<Node>> buckets;
+    long long current = 0;
+    std::size_t count = 0;
+
+    explicit DialQueue(long long max_weight) : buckets(max_weight + 1) {}
+
+    bool empty() const { return count == 0; }
+
+    void push(long long d, int v)
+    {
+        buckets[d % static_cast<long long>(buckets.size())].push_back({d, v});
+        ++count;
+    }
+
+    Node pop()
+    {
+        const long long size = static_cast<long long>(buckets.size());
+        while (buckets[current % size].empty()) {
+            ++current;
+        }
+        std::vector<Node> &bucket = buckets[current % size];
+        Node top = bucket.back();
+        bucket.pop_back();
+        --count;
+        return top;
+    }
+};
+
+// Addressable D-ary min-heap over vertex ids 0..n-1 with decrease-key.
+// pos[v] is the slot of v in heap[] (-1 if absent), so every vertex is stored
+// at most once: the heap never exceeds n entries, unlike lazy deletion.
+// D = 4 keeps the tree shallow and the children of a node in one cache line.
+template <typename Key, int D = 4>
+struct IndexedHeap {
+    std::vector<int> heap;   // heap[i] = vertex
+    std::vector<Key> key;    // key[v]  = priority of vertex v
+    std::vector<int> pos;    // pos[v]  = index of v in heap, or -1
+
+    explicit IndexedHeap(int n) : key(n), pos(n, -1) { heap.reserve(n); }
+
+    bool empty() const { return heap.empty(); }
+    bool contains(int v) const { return pos[v] != -1; }
+
+    void push(int v, Key k)
+    {
+        key[v] = k;
+        pos[v] = static_cast<int>(heap.size());
+        heap.push_back(v);
+        sift_up(pos[v]);
+    }
+
+    // Requires k <= the current key of v
+    void decrease_key(int v, Key k)
+    {
+        key[v] = k;
+        sift_up(pos[v]);
+    }
+
+    void push_or_decrease(int v, Key k)
+    {
+        if (contains(v)) {
+            decrease_key(v, k);
+        } else {
+            push(v, k);
+        }
+    }
+
+    std::pair<Key, int> pop()
+    {
+        int top = heap[0];
+        pos[top] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            pos[last] = 0;
+            sift_down(0);
+        }
+        return {key[top], top};
+    }
+
+    void sift_up(int i)
+    {
+        int v = heap[i];
+        while (i > 0) {
+            int p = (i - 1) / D;
+            if (!(key[v] < key[heap[p]])) {
+                break;
+            }
+            heap[i] = heap[p];
+            pos[heap[i]] = i;
+            i = p;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+    void sift_down(int i)
+    {
+        const int size = static_cast<int>(heap.size());
+        int v = heap[i];
+        while (true) {
+            int first = i * D + 1;
+            if (first >= size) {
+                break;
+            }
+            int best = first;
+            int end = std::min(first + D, size);
+            for (int c = first + 1; c < end; ++c) {
+                if (key[heap[c]] < key[heap[best]]) {
+                    best = c;
+                }
+            }
+            if (!(key[heap[best]] < key[v])) {
+                break;
+            }
+            heap[i] = heap[best];
+            pos[heap[i]] = i;
+            i = best;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+};
+
 // Dijkstra's algorithm: computes shortest distances and parents
+// PQ selects the priority queue (BinaryHeapQueue, RadixHeapQueue, DialQueue)
+template <typename PQ = BinaryHeapQueue>
 void dijkstra(int n,
               int source,
               const AdjList &adj,
@@ -22,15 +231,22 @@ void dijkstra(int n,
 
     dist[source] = 0;
 
-    // Min-heap: (distance, vertex)
-    using Node = std::pair<long long, int>;
-    std::priority_queue<Node, std::vector<Node>, std::greater<>> pq;
+    long long max_weight = 0;
+    if constexpr (PQ::needs_max_weight) {
+        for (int u = 0; u < n; ++u) {
+            for (const auto &[v, w] : adj[u]) {
+                max_weight = std::max(max_weight, w);
+            }
+        }
+    }
+
+    // Min-priority queue: (distance, vertex)
+    PQ pq(max_weight);
 
-    pq.push({0, source});
+    pq.push(0, source);
 
     while (!pq.empty()) {
-        auto [d, u] = pq.top();
-        pq.pop();
+        auto [d, u] = pq.pop();
 
         // If this is an outdated entry, skip it
         if (d != dist[u]) {
@@ -42,7 +258,263 @@ void dijkstra(int n,
             if (dist[u] + w < dist[v]) {
                 dist[v] = dist[u] + w;
                 parent[v] = u;
-                pq.push({dist[v], v});
+                pq.push(dist[v], v);
+            }
+        }
+    }
+}
+
+// Compressed Sparse Row (CSR) graph, same layout as CSR Graph/main.cpp.
+// The out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+// Three flat arrays instead of one heap allocation per vertex.
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Convert an existing AdjList into CSR form
+CSRGraph<long long> to_csr(const AdjList &adj)
+{
+    const int n = static_cast<int>(adj.size());
+    CSRBuilder<long long> builder(n);
+    for (int u = 0; u < n; ++u) {
+        for (const auto &[v, w] : adj[u]) {
+            builder.add_edge(u, v, w);
+        }
+    }
+    return builder.build();
+}
+
+// Dijkstra over a CSR graph: same algorithm, contiguous neighbour scans
+template <typename PQ = BinaryHeapQueue>
+void dijkstra(int source,
+              const CSRGraph<long long> &g,
+              std::vector<long long> &dist,
+              std::vector<int> &parent)
+{
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+
+    dist.assign(g.n, INF);
+    parent.assign(g.n, -1);
+
+    dist[source] = 0;
+
+    long long max_weight = 0;
+    if constexpr (PQ::needs_max_weight) {
+        for (long long w : g.weight) {
+            max_weight = std::max(max_weight, w);
+        }
+    }
+
+    PQ pq(max_weight);
+
+    pq.push(0, source);
+
+    while (!pq.empty()) {
+        auto [d, u] = pq.pop();
+
+        if (d != dist[u]) {
+            continue;
+        }
+
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            int v = g.target[e];
+            long long w = g.weight[e];
+            if (dist[u] + w < dist[v]) {
+                dist[v] = dist[u] + w;
+                parent[v] = u;
+                pq.push(dist[v], v);
+            }
+        }
+    }
+}
+
+// Dijkstra with an indexed 4-ary heap: a relaxed vertex that is already
+// queued gets its key decreased instead of a duplicate entry, so the queue
+// holds at most n vertices and no stale entries are ever popped.
+void dijkstra_decrease_key(int source,
+                           const CSRGraph<long long> &g,
+                           std::vector<long long> &dist,
+                           std::vector<int> &parent)
+{
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+
+    dist.assign(g.n, INF);
+    parent.assign(g.n, -1);
+
+    dist[source] = 0;
+
+    IndexedHeap<long long> pq(g.n);
+    pq.push(source, 0);
+
+    while (!pq.empty()) {
+        auto [d, u] = pq.pop();
+
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            int v = g.target[e];
+            long long w = g.weight[e];
+            if (d + w < dist[v]) {
+                dist[v] = d + w;
+                parent[v] = u;
+                pq.push_or_decrease(v, dist[v]);
+            }
+        }
+    }
+}
+
+// Reusable query workspace with generation-counter (timestamp) invalidation.
+// stamp[v] == generation means dist[v]/parent[v] belong to the current query;
+// any other value means "untouched" (dist INF, parent -1). Starting a query
+// is a single increment, so repeated queries cost O(explored region) instead
+// of the O(n) dist.assign / parent.assign of dijkstra().
+struct SearchWorkspace {
+    std::vector<long long> dist;
+    std::vector<int> parent;
+    std::vector<unsigned> stamp;
+    unsigned generation = 0;
+    std::vector<std::pair<long long, int>> heap;   // binary heap, capacity reused
+
+    explicit SearchWorkspace(int n) : dist(n), parent(n), stamp(n, 0) {}
+
+    void next_query()
+    {
+        heap.clear();
+        if (++generation == 0) {   // wrapped around: invalidate everything once
+            std::fill(stamp.begin(), stamp.end(), 0);
+            generation = 1;
+        }
+    }
+
+    long long distance(int v) const
+    {
+        return stamp[v] == generation ? dist[v] : std::numeric_limits<long long>::max() / 4;
+    }
+
+    int parent_of(int v) const { return stamp[v] == generation ? parent[v] : -1; }
+
+    void set(int v, long long d, int p)
+    {
+        stamp[v] = generation;
+        dist[v] = d;
+        parent[v] = p;
+    }
+
+    // Path [source, ..., v] of the last query, empty if v was not reached
+    std::vector<int> path_to(int v) const
+    {
+        std::vector<int> path;
+        if (stamp[v] != generation) {
+            return path;
+        }
+        for (int cur = v; cur != -1; cur = parent_of(cur)) {
+            path.push_back(cur);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+// Dijkstra into a reusable workspace. With target != -1 the search stops as
+// soon as target is settled (point-to-point query); distances of vertices
+// settled before that are final.
+void dijkstra(int source,
+              const CSRGraph<long long> &g,
+              SearchWorkspace &ws,
+              int target = -1)
+{
+    const auto later = std::greater<>();
+    ws.next_query();
+
+    ws.set(source, 0, -1);
+    ws.heap.push_back({0, source});
+
+    while (!ws.heap.empty()) {
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), later);
+        auto [d, u] = ws.heap.back();
+        ws.heap.pop_back();
+
+        // If this is an outdated entry, skip it
+        if (d != ws.dist[u]) {
+            continue;
+        }
+        if (u == target) {
+            break;
+        }
+
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            int v = g.target[e];
+            long long nd = d + g.weight[e];
+            if (nd < ws.distance(v)) {
+                ws.set(v, nd, u);
+                ws.heap.push_back({nd, v});
+                std::push_heap(ws.heap.begin(), ws.heap.end(), later);
             }
         }
     }
@@ -98,23 +570,28 @@ int main()
     int n, m;
     std::cin >> n >> m;
 
-    AdjList adj(n);
+    CSRBuilder<long long> builder(n);
+    builder.reserve(m);
 
     // Read m directed edges (u, v, w)
     for (int i = 0; i < m; ++i) {
         int u, v;
         long long w;
         std::cin >> u >> v >> w;
-        adj[u].push_back({v, w});
+        builder.add_edge(u, v, w);
     }
 
+    CSRGraph<long long> g = builder.build();
+
     int source;
     std::cin >> source;
 
     std::vector<long long> dist;
     std::vector<int> parent;
 
-    dijkstra(n, source, adj, dist, parent);
+    // Swap the queue at compile time, e.g. dijkstra<RadixHeapQueue>(...)
+    // or dijkstra<DialQueue>(...) when the maximum weight is small.
+    dijkstra(source, g, dist, parent);
     auto paths = build_all_paths(source, parent);
 
     const long long INF = std::numeric_limits<long long>::max() / 4;
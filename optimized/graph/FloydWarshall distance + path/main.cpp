@@ -0,0 +1,442 @@
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <thread>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// ------------------------------------------------------------
+// Min-plus row kernels
+// ------------------------------------------------------------
+// relax_row:       dij[j] = min(dij[j], dik + dkj[j]), j < len.
+//                  This is the whole inner loop of Floyd-Warshall.
+// relax_row_paths: the same on (distance, edge count) pairs
+//                  compared lexicographically; where a pair
+//                  improves, the next hop nij[j] becomes nik.
+//                  The edge count breaks ties between equal
+//                  distances, so zero-weight cycles can never
+//                  close a loop in the next-hop matrix.
+// The AVX2 overloads for int (8 lanes) and long long (4 lanes)
+// are picked by overload resolution when __AVX2__ is defined;
+// otherwise every type uses the scalar templates.
+// ------------------------------------------------------------
+template <typename T>
+inline void relax_row(T *dij, T dik, const T *dkj, int len)
+{
+    for (int j = 0; j < len; ++j) {
+        dij[j] = std::min(dij[j], dik + dkj[j]);
+    }
+}
+
+template <typename T>
+inline void relax_row_paths(T *dij, int *lij, int *nij,
+                            T dik, int lik, int nik,
+                            const T *dkj, const int *lkj, int len)
+{
+    for (int j = 0; j < len; ++j) {
+        T candidate = dik + dkj[j];
+        int edges = lik + lkj[j];
+        if (candidate < dij[j] || (candidate == dij[j] && edges < lij[j])) {
+            dij[j] = candidate;
+            lij[j] = edges;
+            nij[j] = nik;
+        }
+    }
+}
+
+#ifdef __AVX2__
+inline void relax_row(int *dij, int dik, const int *dkj, int len)
+{
+    const __m256i vik = _mm256_set1_epi32(dik);
+    int j = 0;
+    for (; j + 8 <= len; j += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dij + j));
+        __m256i c = _mm256_add_epi32(vik, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dkj + j)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dij + j), _mm256_min_epi32(d, c));
+    }
+    relax_row<int>(dij + j, dik, dkj + j, len - j);
+}
+
+inline void relax_row(long long *dij, long long dik, const long long *dkj, int len)
+{
+    const __m256i vik = _mm256_set1_epi64x(dik);
+    int j = 0;
+    for (; j + 4 <= len; j += 4) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dij + j));
+        __m256i c = _mm256_add_epi64(vik, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dkj + j)));
+        __m256i better = _mm256_cmpgt_epi64(d, c);   // no 64-bit min in AVX2
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dij + j), _mm256_blendv_epi8(d, c, better));
+    }
+    relax_row<long long>(dij + j, dik, dkj + j, len - j);
+}
+
+inline void relax_row_paths(int *dij, int *lij, int *nij,
+                            int dik, int lik, int nik,
+                            const int *dkj, const int *lkj, int len)
+{
+    const __m256i vik = _mm256_set1_epi32(dik);
+    const __m256i vlik = _mm256_set1_epi32(lik);
+    const __m256i vnik = _mm256_set1_epi32(nik);
+    int j = 0;
+    for (; j + 8 <= len; j += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dij + j));
+        __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lij + j));
+        __m256i c = _mm256_add_epi32(vik, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dkj + j)));
+        __m256i cl = _mm256_add_epi32(vlik, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lkj + j)));
+        __m256i better = _mm256_or_si256(_mm256_cmpgt_epi32(d, c),
+                                         _mm256_and_si256(_mm256_cmpeq_epi32(d, c), _mm256_cmpgt_epi32(l, cl)));
+        __m256i hop = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(nij + j));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dij + j), _mm256_blendv_epi8(d, c, better));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lij + j), _mm256_blendv_epi8(l, cl, better));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(nij + j), _mm256_blendv_epi8(hop, vnik, better));
+    }
+    relax_row_paths<int>(dij + j, lij + j, nij + j, dik, lik, nik, dkj + j, lkj + j, len - j);
+}
+
+inline void relax_row_paths(long long *dij, int *lij, int *nij,
+                            long long dik, int lik, int nik,
+                            const long long *dkj, const int *lkj, int len)
+{
+    const __m256i vik = _mm256_set1_epi64x(dik);
+    const __m128i vlik = _mm_set1_epi32(lik);
+    const __m128i vnik = _mm_set1_epi32(nik);
+    // picks the low 32 bits of each 64-bit mask lane into the low 128 bits
+    const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+    int j = 0;
+    for (; j + 4 <= len; j += 4) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dij + j));
+        __m256i c = _mm256_add_epi64(vik, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dkj + j)));
+        __m128i less = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_cmpgt_epi64(d, c), pack));
+        __m128i equal = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_cmpeq_epi64(d, c), pack));
+
+        __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lij + j));
+        __m128i cl = _mm_add_epi32(vlik, _mm_loadu_si128(reinterpret_cast<const __m128i *>(lkj + j)));
+        __m128i better = _mm_or_si128(less, _mm_and_si128(equal, _mm_cmpgt_epi32(l, cl)));
+        __m256i wide = _mm256_cvtepi32_epi64(better);   // sign-extend back to 64-bit lanes
+
+        __m128i hop = _mm_loadu_si128(reinterpret_cast<const __m128i *>(nij + j));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dij + j), _mm256_blendv_epi8(d, c, wide));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lij + j), _mm_blendv_epi8(l, cl, better));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(nij + j), _mm_blendv_epi8(hop, vnik, better));
+    }
+    relax_row_paths<long long>(dij + j, lij + j, nij + j, dik, lik, nik, dkj + j, lkj + j, len - j);
+}
+#endif
+
+// ------------------------------------------------------------
+// Blocked Floyd-Warshall
+// ------------------------------------------------------------
+// dist is one flat row-major matrix, rows padded to a multiple
+// of the tile size (padding vertices are isolated, so they never
+// change anything). For every diagonal tile index kb:
+//   1. Diagonal: plain Floyd-Warshall inside tile (kb, kb)
+//   2. Cross:    tiles in row kb and column kb, using the
+//                finished diagonal tile
+//   3. Rest:     every other tile (ib, jb) from (ib, kb) and
+//                (kb, jb), which no longer change in this step
+// Tiles of one stage are independent, so stages 2 and 3 are
+// spread over a thread pool (the caller is thread 0) through an
+// atomic counter, with a barrier between stages. Each tile
+// update touches three tile x tile blocks, which stay in cache;
+// the innermost loop is relax_row over one tile row.
+//
+// With with_paths, hop[u][v] is the vertex after u on a shortest
+// u -> v path. The blocked order lets a tile see intermediates
+// of its own block early, so with zero-weight cycles plain
+// strict improvement can leave the hops going round in circles;
+// comparing (distance, edge count) pairs instead keeps every
+// hop walk strictly shorter in edges, so it always reaches v.
+//
+// dist(u, v) is INF when v is unreachable. With negative
+// weights the total weight of any simple path must stay well
+// above -INF / 2. A negative cycle whose highest vertex is k
+// shows up as d[k][k] < 0 before k is used as an intermediate,
+// so the diagonal stage checks that first and the run stops
+// there: has_negative_cycle is set, the values are left
+// half-finished, and no sum ever runs away towards overflow.
+// ------------------------------------------------------------
+template <typename T>
+struct FloydWarshall {
+    static constexpr T INF = std::numeric_limits<T>::max() / 4;
+
+    int n;
+    int tile;
+    int stride;                   // padded row length, multiple of tile
+    bool with_paths;
+    bool has_negative_cycle = false;
+    std::vector<T> d;             // stride x stride
+    std::vector<int> hop;         // next hop after u towards v, -1 if none (only with_paths)
+    std::vector<int> edges;       // edge count of that path, tie-breaker (only with_paths)
+
+    FloydWarshall(int n, bool with_paths = false, int tile = 64)
+        : n(n), tile(std::max(1, tile)), with_paths(with_paths)
+    {
+        stride = (n + this->tile - 1) / this->tile * this->tile;
+        d.assign(static_cast<std::size_t>(stride) * stride, INF);
+        if (with_paths) {
+            hop.assign(d.size(), -1);
+            edges.assign(d.size(), 0);
+        }
+        for (int v = 0; v < stride; ++v) {
+            d[index(v, v)] = 0;
+            if (with_paths) {
+                hop[index(v, v)] = v;
+            }
+        }
+    }
+
+    std::size_t index(int u, int v) const { return static_cast<std::size_t>(u) * stride + v; }
+
+    // Keeps the lightest of parallel edges
+    void add_edge(int u, int v, T w)
+    {
+        if (w < d[index(u, v)]) {
+            d[index(u, v)] = w;
+            if (with_paths) {
+                hop[index(u, v)] = v;
+                edges[index(u, v)] = 1;
+            }
+        }
+    }
+
+    T dist(int u, int v) const { return d[index(u, v)]; }
+
+    // Rows [ib * tile, ...) x columns [jb * tile, ...) relaxed through the
+    // intermediates of tile kb, one k at a time (needed when the tile is
+    // its own source; harmless otherwise). Returns false, leaving the tile
+    // half-done, if the diagonal tile meets a k with d[k][k] < 0.
+    bool update_tile(int ib, int jb, int kb)
+    {
+        const int i0 = ib * tile;
+        const int j0 = jb * tile;
+        const int k0 = kb * tile;
+        for (int k = k0; k < k0 + tile; ++k) {
+            if (ib == kb && jb == kb && d[index(k, k)] < 0) {
+                return false;   // negative cycle through k: stop before it grows
+            }
+            const T *dkj = &d[index(k, j0)];
+            for (int i = i0; i < i0 + tile; ++i) {
+                const T dik = d[index(i, k)];
+                if (dik >= INF / 2) {
+                    continue;   // i cannot reach k: nothing to relax
+                }
+                if (with_paths) {
+                    relax_row_paths(&d[index(i, j0)], &edges[index(i, j0)], &hop[index(i, j0)],
+                                    dik, edges[index(i, k)], hop[index(i, k)],
+                                    dkj, &edges[index(k, j0)], tile);
+                } else {
+                    relax_row(&d[index(i, j0)], dik, dkj, tile);
+                }
+            }
+        }
+        return true;
+    }
+
+    void run(int num_threads = static_cast<int>(std::thread::hardware_concurrency()))
+    {
+        const int blocks = stride / tile;
+        const int workers = std::max(1, num_threads);
+
+        enum class Stage { Diagonal, Cross, Rest };
+        Stage stage = Stage::Diagonal;
+        int kb = 0;
+        bool done = blocks == 0;
+        std::atomic<int> next_task{0};
+
+        auto task_count = [&]() -> int {
+            switch (stage) {
+            case Stage::Diagonal:
+                return 1;
+            case Stage::Cross:
+                return 2 * (blocks - 1);
+            case Stage::Rest:
+                return (blocks - 1) * (blocks - 1);
+            }
+            return 0;
+        };
+
+        auto run_task = [&](int t) {
+            const int others = blocks - 1;
+            auto skip_kb = [&](int b) { return b < kb ? b : b + 1; };
+            switch (stage) {
+            case Stage::Diagonal:
+                if (!update_tile(kb, kb, kb)) {
+                    has_negative_cycle = true;
+                }
+                break;
+            case Stage::Cross:
+                if (t < others) {
+                    update_tile(kb, skip_kb(t), kb);            // row kb
+                } else {
+                    update_tile(skip_kb(t - others), kb, kb);   // column kb
+                }
+                break;
+            case Stage::Rest:
+                update_tile(skip_kb(t / others), skip_kb(t % others), kb);
+                break;
+            }
+        };
+
+        // Serial bookkeeping, run by the last thread to reach each barrier
+        auto on_stage_end = [&]() noexcept {
+            if (stage == Stage::Diagonal) {
+                stage = Stage::Cross;
+                done = has_negative_cycle;
+            } else if (stage == Stage::Cross) {
+                stage = Stage::Rest;
+            } else {
+                stage = Stage::Diagonal;
+                done = ++kb == blocks;
+            }
+            next_task.store(0, std::memory_order_relaxed);
+        };
+        std::barrier sync(workers, on_stage_end);
+
+        auto worker = [&]() {
+            while (!done) {
+                const int count = task_count();
+                for (int t = next_task++; t < count; t = next_task++) {
+                    run_task(t);
+                }
+                sync.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(workers - 1);
+        for (int t = 1; t < workers; ++t) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (std::thread &th : pool) {
+            th.join();
+        }
+
+        // Sums with an INF operand may have dipped a little below INF
+        for (int u = 0; u < n; ++u) {
+            for (int v = 0; v < n; ++v) {
+                if (d[index(u, v)] >= INF / 2) {
+                    d[index(u, v)] = INF;
+                    if (with_paths) {
+                        hop[index(u, v)] = -1;
+                    }
+                }
+            }
+            has_negative_cycle = has_negative_cycle || d[index(u, u)] < 0;
+        }
+    }
+
+    // Vertices [u, ..., v] of a shortest path (needs with_paths).
+    // Empty if u or v is not a vertex, v is unreachable or the graph has a
+    // negative cycle.
+    std::vector<int> path(int u, int v) const
+    {
+        if (u < 0 || u >= n || v < 0 || v >= n) {
+            return {};
+        }
+        if (!with_paths || has_negative_cycle || hop[index(u, v)] == -1) {
+            return {};
+        }
+        std::vector<int> result{u};
+        while (u != v) {
+            u = hop[index(u, v)];
+            result.push_back(u);
+        }
+        return result;
+    }
+};
+
+// A ring 0 -> 1 -> ... -> n-1 -> 0 of heavy negative edges spread over
+// many tiles. Running through the cycle would double the distances on it
+// once per intermediate and overflow T long before the last round.
+template <typename T>
+bool ring_has_negative_cycle(bool with_paths)
+{
+    const int n = 200;
+    const T w = -(FloydWarshall<T>::INF / 2 / n);   // simple paths stay above -INF / 2
+    FloydWarshall<T> fw(n, with_paths, 8);
+    for (int v = 0; v < n; ++v) {
+        fw.add_edge(v, (v + 1) % n, w);
+    }
+    fw.run(4);
+    return fw.has_negative_cycle;
+}
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    // Paths wanted, tiny tiles so the example spans several tiles
+    FloydWarshall<long long> fw(n, true, 2);
+
+    // Read m directed edges (u, v, w); w may be negative
+    for (int i = 0; i < m; ++i) {
+        int u, v;
+        long long w;
+        std::cin >> u >> v >> w;
+        fw.add_edge(u, v, w);
+    }
+
+    fw.run();
+
+    if (fw.has_negative_cycle) {
+        std::cout << "Negative cycle\n";
+    } else {
+        // One row per source vertex
+        for (int u = 0; u < n; ++u) {
+            for (int v = 0; v < n; ++v) {
+                if (fw.dist(u, v) == FloydWarshall<long long>::INF) {
+                    std::cout << "INF";
+                } else {
+                    std::cout << fw.dist(u, v);
+                }
+                std::cout << (v + 1 < n ? ' ' : '\n');
+            }
+        }
+
+        if (n > 0) {
+            std::cout << "Path " << n - 1 << " -> 0:";
+            for (int v : fw.path(n - 1, 0)) {
+                std::cout << ' ' << v;
+            }
+            std::cout << '\n';
+        }
+    }
+
+    // Negative cycles are reported without overflowing, for both widths
+    std::cout << "Ring negative cycle (int / long long, no paths / paths):";
+    for (bool with_paths : {false, true}) {
+        std::cout << ' ' << ring_has_negative_cycle<int>(with_paths)
+                  << ' ' << ring_has_negative_cycle<long long>(with_paths);
+    }
+    std::cout << '\n';
+
+    return 0;
+}
+
+
+/*
+Example input (copy-paste when running):
+
+5 7
+0 1 3
+0 2 8
+1 3 1
+2 1 4
+3 0 2
+3 2 -5
+4 3 6
+
+Meaning:
+- 5 vertices (0..4), 7 directed edges (u, v, w), one of them negative
+- Output is the 5 x 5 distance matrix, row u = distances from u,
+  then the vertices of a shortest path from n - 1 (here 4) to 0
+*/
@@ -0,0 +1,298 @@
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+// Compressed Sparse Row (CSR) graph, same layout as CSR Graph/main.cpp.
+// The out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+// Three flat arrays instead of one heap allocation per vertex.
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Directed edge u -> v with weight w, as in the Bellman-Ford template
+struct Edge {
+    int from;
+    int to;
+    long long weight;
+};
+
+// Johnson potentials: Bellman-Ford from a virtual source q with a 0-weight
+// edge q -> v to every vertex. Those edges only matter in the first round,
+// which just sets every h[v] to 0, so q is never materialised: start from
+// h = 0 everywhere and run the usual rounds with the early exit.
+// Returns false if the graph has a negative cycle (anywhere, since q
+// reaches every vertex).
+bool johnson_potentials(int n, const std::vector<Edge> &edges, std::vector<long long> &h)
+{
+    h.assign(n, 0);
+
+    for (int round = 0; round < n; ++round) {
+        bool any_relaxed = false;
+        for (const Edge &e : edges) {
+            if (h[e.from] + e.weight < h[e.to]) {
+                h[e.to] = h[e.from] + e.weight;
+                any_relaxed = true;
+            }
+        }
+        if (!any_relaxed) {
+            return true;
+        }
+    }
+
+    // n rounds (the virtual source makes n + 1 vertices) still relaxing
+    for (const Edge &e : edges) {
+        if (h[e.from] + e.weight < h[e.to]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reusable per-thread scratch for repeated Dijkstra runs on one graph.
+// dist is allocated once; after a run only the entries listed in touched
+// are reset, so each run costs O(explored), not O(n) extra.
+struct DijkstraScratch {
+    std::vector<long long> dist;
+    std::vector<int> touched;
+    std::vector<std::pair<long long, int>> heap;   // binary heap, capacity reused
+
+    explicit DijkstraScratch(int n) : dist(n, std::numeric_limits<long long>::max() / 4) {}
+
+    void reset()
+    {
+        const long long INF = std::numeric_limits<long long>::max() / 4;
+        for (int v : touched) {
+            dist[v] = INF;
+        }
+        touched.clear();
+        heap.clear();
+    }
+};
+
+// Plain Dijkstra from source into scratch (weights must be >= 0)
+void dijkstra(int source, const CSRGraph<long long> &g, DijkstraScratch &s)
+{
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+    const auto later = std::greater<>();
+    s.reset();
+
+    s.dist[source] = 0;
+    s.touched.push_back(source);
+    s.heap.push_back({0, source});
+
+    while (!s.heap.empty()) {
+        std::pop_heap(s.heap.begin(), s.heap.end(), later);
+        auto [d, u] = s.heap.back();
+        s.heap.pop_back();
+
+        // If this is an outdated entry, skip it
+        if (d != s.dist[u]) {
+            continue;
+        }
+
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            int v = g.target[e];
+            long long nd = d + g.weight[e];
+            if (nd < s.dist[v]) {
+                if (s.dist[v] == INF) {
+                    s.touched.push_back(v);
+                }
+                s.dist[v] = nd;
+                s.heap.push_back({nd, v});
+                std::push_heap(s.heap.begin(), s.heap.end(), later);
+            }
+        }
+    }
+}
+
+// Row-major n x n matrix, at(u, v) = d(u, v), INF where unreachable
+struct DistanceMatrix {
+    int n = 0;
+    bool has_negative_cycle = false;   // then dist is left empty
+    std::vector<long long> dist;
+
+    long long at(int u, int v) const { return dist[static_cast<std::size_t>(u) * n + v]; }
+};
+
+// Johnson's algorithm, O(n m + n (n + m) log n):
+//   1. potentials h from one Bellman-Ford (johnson_potentials)
+//   2. reweight w'(u, v) = w + h[u] - h[v] >= 0, one shared CSR graph
+//   3. one Dijkstra per source, sources handed out to a pool of threads
+//      through an atomic counter, each thread reusing one scratch
+//   4. d(u, v) = d'(u, v) - h[u] + h[v], written straight into row u
+DistanceMatrix johnson(int n,
+                       const std::vector<Edge> &edges,
+                       int num_threads = static_cast<int>(std::thread::hardware_concurrency()))
+{
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+    const int T = std::max(1, std::min(num_threads, n));
+
+    DistanceMatrix result;
+    result.n = n;
+
+    std::vector<long long> h;
+    if (!johnson_potentials(n, edges, h)) {
+        result.has_negative_cycle = true;
+        return result;
+    }
+
+    CSRBuilder<long long> builder(n);
+    builder.reserve(edges.size());
+    for (const Edge &e : edges) {
+        builder.add_edge(e.from, e.to, e.weight + h[e.from] - h[e.to]);
+    }
+    const CSRGraph<long long> g = builder.build();
+
+    result.dist.assign(static_cast<std::size_t>(n) * n, INF);
+    std::atomic<int> next_source{0};
+
+    auto worker = [&]() {
+        DijkstraScratch scratch(n);
+        for (int u = next_source++; u < n; u = next_source++) {
+            dijkstra(u, g, scratch);
+            long long *row = result.dist.data() + static_cast<std::size_t>(u) * n;
+            for (int v : scratch.touched) {
+                row[v] = scratch.dist[v] - h[u] + h[v];
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(T - 1);
+    for (int t = 1; t < T; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &th : pool) {
+        th.join();
+    }
+
+    return result;
+}
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    // Read m directed edges (u, v, w); w may be negative
+    std::vector<Edge> edges(m);
+    for (Edge &e : edges) {
+        std::cin >> e.from >> e.to >> e.weight;
+    }
+
+    DistanceMatrix matrix = johnson(n, edges);
+
+    if (matrix.has_negative_cycle) {
+        std::cout << "Negative cycle\n";
+        return 0;
+    }
+
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+
+    // One row per source vertex
+    for (int u = 0; u < n; ++u) {
+        for (int v = 0; v < n; ++v) {
+            if (matrix.at(u, v) >= INF) {
+                std::cout << "INF";
+            } else {
+                std::cout << matrix.at(u, v);
+            }
+            std::cout << (v + 1 < n ? ' ' : '\n');
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+Example input (copy-paste when running):
+
+5 7
+0 1 3
+0 2 8
+1 3 1
+2 1 4
+3 0 2
+3 2 -5
+4 3 6
+
+Meaning:
+- 5 vertices (0..4), 7 directed edges (u, v, w), one of them negative
+- Output is the 5 x 5 distance matrix, row u = distances from u
+*/
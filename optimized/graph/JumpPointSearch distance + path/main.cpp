@@ -0,0 +1,276 @@
+#include <bits/stdc++.h>
+
+// A coordinate (i, j).
+using Coord = std::pair<int, int>;
+
+/* ---------------------------------------------------------
+   JUMP POINT SEARCH (uniform-cost grids)
+   Grid convention as in Lee: 0 = free, 1 = blocked.
+
+   A* over "jump points" only. From a node, the search runs
+   in a straight (or diagonal) line and skips every cell whose
+   neighbours can be reached at least as cheaply some other
+   way; it stops only at the goal or at a cell with a forced
+   neighbour (a free side cell whose cell "behind" is blocked).
+   On open maps the heap therefore holds a handful of corners
+   instead of every reachable cell.
+
+   - 4-connected: step cost 1. A vertical run also scans
+     sideways from every cell it passes, so turns are found.
+   - 8-connected: straight cost 1, diagonal cost sqrt(2);
+     diagonal moves may not cut corners (both orthogonal
+     cells must be free).
+
+   The engine keeps its per-query arrays between queries
+   (generation stamps, as in LeeWorkspace), so a query costs
+   O(cells scanned), not O(n * m).
+   --------------------------------------------------------- */
+struct JumpPointSearch {
+    int n = 0;
+    int m = 0;
+    bool diagonal = false;
+    std::vector<unsigned char> free_cell;    // cell = i * m + j
+
+    // per-query state, valid only where stamp == generation
+    std::vector<double> g;
+    std::vector<int> parent;                 // previous jump point, -1 for the start
+    std::vector<unsigned> stamp;
+    std::vector<unsigned> closed;
+    unsigned generation = 0;
+    std::vector<std::pair<double, int>> heap;   // (f, cell), min-heap via std::greater
+
+    int goal_i = -1;
+    int goal_j = -1;
+    double path_cost = -1;                   // cost of the last path found, -1 if none
+
+    JumpPointSearch(const std::vector<std::vector<int>>& grid, bool diagonal = false)
+        : diagonal(diagonal) {
+        n = static_cast<int>(grid.size());
+        m = n > 0 ? static_cast<int>(grid[0].size()) : 0;
+        free_cell.assign(n * m, 0);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < m; ++j) {
+                free_cell[i * m + j] = grid[i][j] != 1;
+            }
+        }
+        g.resize(n * m);
+        parent.resize(n * m);
+        stamp.assign(n * m, 0);
+        closed.assign(n * m, 0);
+    }
+
+    bool walkable(int i, int j) const {
+        return i >= 0 && i < n && j >= 0 && j < m && free_cell[i * m + j];
+    }
+
+    double heuristic(int i, int j) const {
+        int di = std::abs(i - goal_i);
+        int dj = std::abs(j - goal_j);
+        if (!diagonal) return di + dj;
+        return std::max(di, dj) + (std::sqrt(2.0) - 1.0) * std::min(di, dj);
+    }
+
+    double step_cost(int a, int b) const {
+        int di = std::abs(a / m - b / m);
+        int dj = std::abs(a % m - b % m);
+        return std::max(di, dj) + (std::sqrt(2.0) - 1.0) * std::min(di, dj);
+    }
+
+    // Straight run from (i, j) along (di, dj), one of which is 0.
+    // Returns the next jump point, or -1 if the run hits a wall.
+    int jump_straight(int i, int j, int di, int dj) const {
+        while (true) {
+            i += di;
+            j += dj;
+            if (!walkable(i, j)) return -1;
+            if (i == goal_i && j == goal_j) return i * m + j;
+
+            if (di != 0) {
+                if ((walkable(i, j - 1) && !walkable(i - di, j - 1)) ||
+                    (walkable(i, j + 1) && !walkable(i - di, j + 1))) {
+                    return i * m + j;
+                }
+                // 4-connected: turning left/right is the only way sideways
+                if (!diagonal &&
+                    (jump_straight(i, j, 0, 1) != -1 || jump_straight(i, j, 0, -1) != -1)) {
+                    return i * m + j;
+                }
+            } else {
+                if ((walkable(i - 1, j) && !walkable(i - 1, j - dj)) ||
+                    (walkable(i + 1, j) && !walkable(i + 1, j - dj))) {
+                    return i * m + j;
+                }
+            }
+        }
+    }
+
+    // Diagonal run: stops where either straight component finds a jump point.
+    int jump_diagonal(int i, int j, int di, int dj) const {
+        while (true) {
+            if (!walkable(i + di, j) || !walkable(i, j + dj)) return -1;   // no corner cutting
+            i += di;
+            j += dj;
+            if (!walkable(i, j)) return -1;
+            if (i == goal_i && j == goal_j) return i * m + j;
+
+            if (jump_straight(i, j, di, 0) != -1 || jump_straight(i, j, 0, dj) != -1) {
+                return i * m + j;
+            }
+        }
+    }
+
+    int jump(int i, int j, int di, int dj) const {
+        return (di != 0 && dj != 0) ? jump_diagonal(i, j, di, dj)
+                                    : jump_straight(i, j, di, dj);
+    }
+
+    // Pruned directions to try from `cell`, given how we arrived there.
+    int directions(int cell, int (&out)[8][2]) const {
+        int cnt = 0;
+        auto add = [&](int di, int dj) { out[cnt][0] = di; out[cnt][1] = dj; ++cnt; };
+
+        if (parent[cell] == -1) {
+            add(-1, 0); add(0, 1); add(1, 0); add(0, -1);
+            if (diagonal) { add(-1, 1); add(1, 1); add(1, -1); add(-1, -1); }
+            return cnt;
+        }
+
+        int i = cell / m, j = cell % m;
+        int pi = parent[cell] / m, pj = parent[cell] % m;
+        int di = (i > pi) - (i < pi);
+        int dj = (j > pj) - (j < pj);
+
+        if (di != 0 && dj != 0) {
+            add(di, 0); add(0, dj); add(di, dj);
+        } else if (di != 0) {
+            add(di, 0); add(0, 1); add(0, -1);
+            if (diagonal) { add(di, 1); add(di, -1); }
+        } else {
+            add(0, dj); add(1, 0); add(-1, 0);
+            if (diagonal) { add(1, dj); add(-1, dj); }
+        }
+        return cnt;
+    }
+
+    void next_query() {
+        heap.clear();
+        if (++generation == 0) {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            std::fill(closed.begin(), closed.end(), 0);
+            generation = 1;
+        }
+    }
+
+    // Full cell-by-cell path from (si, sj) to (gi, gj), like build_path.
+    // Empty if the goal is unreachable; path_cost holds its cost.
+    std::vector<Coord> find_path(int si, int sj, int gi, int gj) {
+        next_query();
+        path_cost = -1;
+        goal_i = gi;
+        goal_j = gj;
+
+        if (!walkable(si, sj) || !walkable(gi, gj)) return {};
+
+        const int start = si * m + sj;
+        const int goal = gi * m + gj;
+        auto cmp = std::greater<std::pair<double, int>>();
+
+        stamp[start] = generation;
+        g[start] = 0;
+        parent[start] = -1;
+        heap.emplace_back(heuristic(si, sj), start);
+
+        int dirs[8][2];
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), cmp);
+            int cell = heap.back().second;
+            heap.pop_back();
+
+            if (closed[cell] == generation) continue;
+            closed[cell] = generation;
+            if (cell == goal) break;
+
+            int i = cell / m, j = cell % m;
+            int cnt = directions(cell, dirs);
+            for (int k = 0; k < cnt; ++k) {
+                int next = jump(i, j, dirs[k][0], dirs[k][1]);
+                if (next == -1 || closed[next] == generation) continue;
+
+                double cand = g[cell] + step_cost(cell, next);
+                if (stamp[next] != generation || cand < g[next]) {
+                    stamp[next] = generation;
+                    g[next] = cand;
+                    parent[next] = cell;
+                    heap.emplace_back(cand + heuristic(next / m, next % m), next);
+                    std::push_heap(heap.begin(), heap.end(), cmp);
+                }
+            }
+        }
+
+        if (closed[goal] != generation) return {};
+        path_cost = g[goal];
+
+        // Jump points goal -> start, then fill in the straight/diagonal runs
+        std::vector<int> jumps;
+        for (int c = goal; c != -1; c = parent[c]) {
+            jumps.push_back(c);
+        }
+        std::reverse(jumps.begin(), jumps.end());
+
+        std::vector<Coord> path;
+        path.emplace_back(si, sj);
+        for (std::size_t k = 1; k < jumps.size(); ++k) {
+            int i = jumps[k - 1] / m, j = jumps[k - 1] % m;
+            int ti = jumps[k] / m, tj = jumps[k] % m;
+            int di = (ti > i) - (ti < i);
+            int dj = (tj > j) - (tj < j);
+            while (i != ti || j != tj) {
+                i += di;
+                j += dj;
+                path.emplace_back(i, j);
+            }
+        }
+        return path;
+    }
+};
+
+/* ---------------------------------------------------------
+   EXAMPLE MAIN for demonstration
+   (remove or adjust for ICPC usage)
+   --------------------------------------------------------- */
+int main() {
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    //example matrix
+    // 0 = free, 1 = blocked
+    std::vector<std::vector<int>> grid = {
+        {0, 0, 0, 0, 1, 0, 0},
+        {1, 1, 0, 0, 1, 0, 1},
+        {0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 1, 0, 0, 1, 0},
+        {0, 0, 0, 0, 0, 0, 0}
+    };
+
+    int si = 0, sj = 0; // example start
+    int gi = 4, gj = 6; // example goal
+
+    for (bool diagonal : {false, true}) {
+        JumpPointSearch jps(grid, diagonal);
+        std::vector<Coord> path = jps.find_path(si, sj, gi, gj);
+
+        std::cout << (diagonal ? "8-connected" : "4-connected") << ": ";
+        if (path.empty()) {
+            std::cout << "No path exists.\n";
+            continue;
+        }
+
+        std::cout << "cost " << jps.path_cost << "\n";
+        for (const Coord& c : path) {
+            std::cout << "(" << c.first << ", " << c.second << ") ";
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+#include <bits/stdc++.h>
+
+// A coordinate (i, j).
+using Coord = std::pair<int, int>;
+
+// Directions: up, right, down, left
+constexpr int DI[4] = {-1, 0, 1, 0};
+constexpr int DJ[4] = {0, 1, 0, -1};
+
+/* ---------------------------------------------------------
+   SEQUENTIAL LEE DISTANCES (reference)
+   Same distances as lee_bfs(grid, si, sj, -1, -1, false).
+   --------------------------------------------------------- */
+std::vector<std::vector<int>> lee_distances(
+    const std::vector<std::vector<int>>& grid,
+    int si, int sj
+) {
+    const int n = static_cast<int>(grid.size());
+    const int m = n > 0 ? static_cast<int>(grid[0].size()) : 0;
+
+    std::vector<std::vector<int>> dist(n, std::vector<int>(m, -1));
+    if (si < 0 || si >= n || sj < 0 || sj >= m || grid[si][sj] == 1) {
+        return dist;
+    }
+
+    std::vector<Coord> q{{si, sj}};
+    dist[si][sj] = 0;
+    for (std::size_t head = 0; head < q.size(); ++head) {
+        auto [i, j] = q[head];
+        for (int dir = 0; dir < 4; ++dir) {
+            int ni = i + DI[dir];
+            int nj = j + DJ[dir];
+            if (ni < 0 || ni >= n || nj < 0 || nj >= m) continue;
+            if (grid[ni][nj] == 1 || dist[ni][nj] != -1) continue;
+            dist[ni][nj] = dist[i][j] + 1;
+            q.emplace_back(ni, nj);
+        }
+    }
+    return dist;
+}
+
+/* ---------------------------------------------------------
+   TILED PARALLEL LEE
+   The grid is cut into tile x tile blocks stored tile-major
+   (each block's cells and distances are contiguous, 64 x 64
+   ints = 16 KB, so a block stays in L2 while it is expanded).
+   Every tile keeps its own frontier. Each BFS level runs in
+   two barrier-separated stages on a fixed thread pool (the
+   caller is thread 0); tiles are handed out through an atomic
+   counter:
+     1. Expand: a thread owns a whole active tile, expands its
+        frontier inside the tile and writes moves that cross
+        the border into the tile's outbox for that side.
+     2. Receive: every tile that got border moves reads its
+        neighbours' outboxes and claims the unvisited cells.
+   A tile's distances are only ever written by the thread that
+   owns the tile in the current stage, so no atomics on dist.
+   Levels are strictly synchronous, so dist is identical to
+   the sequential BFS for any tile size and thread count.
+   --------------------------------------------------------- */
+std::vector<std::vector<int>> lee_bfs_tiled(
+    const std::vector<std::vector<int>>& grid,
+    int si, int sj,
+    int tile = 64,
+    int num_threads = static_cast<int>(std::thread::hardware_concurrency())
+) {
+    const int n = static_cast<int>(grid.size());
+    const int m = n > 0 ? static_cast<int>(grid[0].size()) : 0;
+    const int T = std::max(1, num_threads);
+    const int B = std::max(1, tile);
+    const int area = B * B;
+    const int tiles_r = (n + B - 1) / B;
+    const int tiles_c = (m + B - 1) / B;
+    const int num_tiles = tiles_r * tiles_c;
+
+    std::vector<std::vector<int>> out(n, std::vector<int>(m, -1));
+    if (si < 0 || si >= n || sj < 0 || sj >= m || grid[si][sj] == 1) {
+        return out;
+    }
+
+    // Tile-major storage; padding cells of edge tiles stay blocked
+    auto index_of = [&](int i, int j) -> int {
+        return ((i / B) * tiles_c + j / B) * area + (i % B) * B + j % B;
+    };
+    std::vector<unsigned char> open(static_cast<std::size_t>(num_tiles) * area, 0);
+    std::vector<int> dist(open.size(), -1);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < m; ++j) {
+            open[index_of(i, j)] = grid[i][j] != 1;
+        }
+    }
+
+    // Neighbour tile on each side, -1 at the border of the grid
+    auto neighbour = [&](int t, int dir) -> int {
+        int tr = t / tiles_c + DI[dir];
+        int tc = t % tiles_c + DJ[dir];
+        if (tr < 0 || tr >= tiles_r || tc < 0 || tc >= tiles_c) return -1;
+        return tr * tiles_c + tc;
+    };
+
+    std::vector<std::vector<int>> frontier(num_tiles);   // local cell indices
+    std::vector<std::vector<int>> next(num_tiles);
+    std::vector<std::array<std::vector<int>, 4>> outbox(num_tiles);
+    std::vector<std::atomic<bool>> has_inbox(num_tiles);
+    std::vector<unsigned char> active(num_tiles, 0);
+    for (auto& flag : has_inbox) {
+        flag.store(false, std::memory_order_relaxed);
+    }
+
+    std::vector<std::vector<int>> receivers(T);   // per-thread tile lists
+    std::vector<std::vector<int>> activated(T);
+
+    {
+        int start = index_of(si, sj);
+        int t = start / area;
+        dist[start] = 0;
+        frontier[t].push_back(start % area);
+    }
+
+    std::vector<int> tasks{index_of(si, sj) / area};
+    std::atomic<int> next_task{0};
+
+    enum class Stage { Expand, Receive };
+    Stage stage = Stage::Expand;
+    int level = 0;
+    bool done = false;
+
+    // Serial bookkeeping, run by the last thread to reach each barrier
+    auto on_stage_end = [&]() noexcept {
+        tasks.clear();
+        if (stage == Stage::Expand) {
+            for (auto& list : receivers) {
+                tasks.insert(tasks.end(), list.begin(), list.end());
+                list.clear();
+            }
+            stage = Stage::Receive;
+        } else {
+            for (auto& list : activated) {
+                for (int t : list) {
+                    frontier[t].swap(next[t]);
+                    next[t].clear();
+                    active[t] = 0;
+                    tasks.push_back(t);
+                }
+                list.clear();
+            }
+            ++level;
+            done = tasks.empty();
+            stage = Stage::Expand;
+        }
+        next_task.store(0, std::memory_order_relaxed);
+    };
+    std::barrier sync(T, on_stage_end);
+
+    auto expand = [&](int t, int self) {
+        int* d = &dist[static_cast<std::size_t>(t) * area];
+        const unsigned char* o = &open[static_cast<std::size_t>(t) * area];
+
+        for (int cell : frontier[t]) {
+            int li = cell / B;
+            int lj = cell % B;
+            for (int dir = 0; dir < 4; ++dir) {
+                int ni = li + DI[dir];
+                int nj = lj + DJ[dir];
+                if (ni >= 0 && ni < B && nj >= 0 && nj < B) {
+                    int c = ni * B + nj;
+                    if (o[c] && d[c] == -1) {
+                        d[c] = level + 1;
+                        next[t].push_back(c);
+                    }
+                } else if (neighbour(t, dir) != -1) {
+                    // wrap into the neighbouring tile's local coordinates
+                    outbox[t][dir].push_back(((ni + B) % B) * B + (nj + B) % B);
+                }
+            }
+        }
+        frontier[t].clear();
+
+        for (int dir = 0; dir < 4; ++dir) {
+            if (outbox[t][dir].empty()) continue;
+            int r = neighbour(t, dir);
+            if (!has_inbox[r].exchange(true, std::memory_order_relaxed)) {
+                receivers[self].push_back(r);
+            }
+        }
+        if (!next[t].empty()) {
+            active[t] = 1;
+            activated[self].push_back(t);
+        }
+    };
+
+    auto receive = [&](int r, int self) {
+        int* d = &dist[static_cast<std::size_t>(r) * area];
+        const unsigned char* o = &open[static_cast<std::size_t>(r) * area];
+
+        for (int dir = 0; dir < 4; ++dir) {
+            int s = neighbour(r, dir);
+            if (s == -1) continue;
+            std::vector<int>& box = outbox[s][(dir + 2) % 4];   // s -> r is the opposite side
+            for (int c : box) {
+                if (o[c] && d[c] == -1) {
+                    d[c] = level + 1;
+                    next[r].push_back(c);
+                }
+            }
+            box.clear();
+        }
+        has_inbox[r].store(false, std::memory_order_relaxed);
+
+        if (!next[r].empty() && !active[r]) {
+            active[r] = 1;
+            activated[self].push_back(r);
+        }
+    };
+
+    auto worker = [&](int self) {
+        while (!done) {
+            const int count = static_cast<int>(tasks.size());
+            for (int k = next_task.fetch_add(1, std::memory_order_relaxed); k < count;
+                 k = next_task.fetch_add(1, std::memory_order_relaxed)) {
+                if (stage == Stage::Expand) {
+                    expand(tasks[k], self);
+                } else {
+                    receive(tasks[k], self);
+                }
+            }
+            sync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(T - 1);
+    for (int t = 1; t < T; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (std::thread& th : pool) {
+        th.join();
+    }
+
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < m; ++j) {
+            out[i][j] = dist[index_of(i, j)];
+        }
+    }
+    return out;
+}
+
+/* ---------------------------------------------------------
+   EXAMPLE MAIN for demonstration
+   (remove or adjust for ICPC usage)
+   --------------------------------------------------------- */
+int main() {
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    //example matrix
+    // 0 = free, 1 = blocked
+    std::vector<std::vector<int>> grid = {
+        {0, 0, 0, 0, 1, 0, 0},
+        {1, 1, 0, 0, 1, 0, 1},
+        {0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 1, 0, 0, 1, 0},
+        {0, 0, 0, 0, 0, 0, 0}
+    };
+
+    int si = 0, sj = 0; // example start
+
+    // Tiny tiles so the example actually crosses tile borders
+    std::vector<std::vector<int>> dist = lee_bfs_tiled(grid, si, sj, 2, 4);
+
+    std::cout << "Distances from (" << si << ", " << sj << "):\n";
+    for (const auto& row : dist) {
+        for (int d : row) {
+            std::cout << std::setw(3) << d;
+        }
+        std::cout << "\n";
+    }
+
+    bool same = dist == lee_distances(grid, si, sj);
+    std::cout << "Matches sequential Lee: " << (same ? "yes" : "no") << "\n";
+
+    return 0;
+}
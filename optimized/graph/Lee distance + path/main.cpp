@@ -76,6 +76,104 @@ LeeResult lee_bfs(
     return result;
 }
 
+/* ---------------------------------------------------------
+   LEE WORKSPACE (reusable across queries)
+   Flat dist/parent arrays (cell = i * m + j) allocated once per
+   grid size. A cell's entries are valid only if its stamp equals
+   the current generation, so starting a new query is a single
+   increment instead of allocating and filling two n x m grids:
+   each query costs O(cells it reaches), not O(n * m).
+   --------------------------------------------------------- */
+struct LeeWorkspace {
+    int n = 0;
+    int m = 0;
+    std::vector<int> dist;
+    std::vector<int> parent;          // parent cell index, -1 for the start
+    std::vector<unsigned> stamp;
+    unsigned generation = 0;
+    std::vector<int> queue;           // BFS queue of cell indices, capacity reused
+
+    LeeWorkspace(int n, int m)
+        : n(n), m(m), dist(n * m), parent(n * m), stamp(n * m, 0) {}
+
+    void next_query() {
+        queue.clear();
+        if (++generation == 0) {   // wrapped around: invalidate everything once
+            std::fill(stamp.begin(), stamp.end(), 0);
+            generation = 1;
+        }
+    }
+
+    bool reached(int cell) const { return stamp[cell] == generation; }
+
+    // -1 if (i, j) was not reached by the last query
+    int distance(int i, int j) const {
+        int cell = i * m + j;
+        return reached(cell) ? dist[cell] : -1;
+    }
+};
+
+/* ---------------------------------------------------------
+   LEE BFS INTO A WORKSPACE
+   Same search as lee_bfs; results are read back through
+   ws.distance(i, j) and build_path(ws, ...).
+   --------------------------------------------------------- */
+void lee_bfs(
+    const std::vector<std::vector<int>>& grid,
+    LeeWorkspace& ws,
+    int si, int sj,
+    int gi = -1, int gj = -1,
+    bool stop_at_goal = true
+) {
+    const int n = ws.n;
+    const int m = ws.m;
+
+    auto in_bounds = [&](int i, int j) -> bool {
+        return (i >= 0 && i < n && j >= 0 && j < m);
+    };
+
+    ws.next_query();
+
+    if (!in_bounds(si, sj) || grid[si][sj] == 1) {
+        return;
+    }
+
+    const int start = si * m + sj;
+    const int goal = in_bounds(gi, gj) ? gi * m + gj : -1;
+
+    ws.stamp[start] = ws.generation;
+    ws.dist[start] = 0;
+    ws.parent[start] = -1;
+    ws.queue.push_back(start);
+
+    for (std::size_t head = 0; head < ws.queue.size(); ++head) {
+        int cell = ws.queue[head];
+
+        if (stop_at_goal && cell == goal) {
+            break;
+        }
+
+        int i = cell / m;
+        int j = cell % m;
+
+        for (int dir = 0; dir < 4; ++dir) {
+            int ni = i + DI[dir];
+            int nj = j + DJ[dir];
+
+            if (!in_bounds(ni, nj)) continue;
+            if (grid[ni][nj] == 1) continue;
+
+            int next = ni * m + nj;
+            if (ws.reached(next)) continue;
+
+            ws.stamp[next] = ws.generation;
+            ws.dist[next] = ws.dist[cell] + 1;
+            ws.parent[next] = cell;
+            ws.queue.push_back(next);
+        }
+    }
+}
+
 /* ---------------------------------------------------------
    PATH RECONSTRUCTION (ROAD ALGORITHM)
    Uses parent grid from lee_bfs.
@@ -119,6 +217,366 @@ std::vector<Coord> build_path(
     return path;
 }
 
+/* ---------------------------------------------------------
+   PATH RECONSTRUCTION FROM A WORKSPACE
+   Same output as build_path; empty if the goal was not reached.
+   --------------------------------------------------------- */
+std::vector<Coord> build_path(
+    const LeeWorkspace& ws,
+    int si, int sj,
+    int gi, int gj
+) {
+    std::vector<Coord> path;
+
+    auto in_bounds = [&](int i, int j) -> bool {
+        return (i >= 0 && i < ws.n && j >= 0 && j < ws.m);
+    };
+
+    if (!in_bounds(gi, gj) || !in_bounds(si, sj) || !ws.reached(gi * ws.m + gj)) {
+        return path;
+    }
+
+    for (int cell = gi * ws.m + gj; cell != -1; cell = ws.parent[cell]) {
+        path.emplace_back(cell / ws.m, cell % ws.m);
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+/* ---------------------------------------------------------
+   FLAT GRID (cache-friendly layout for very large maps)
+   One row-major byte array with a 1-cell blocked border, so
+   the BFS inner loop needs no in_bounds checks, and cells are
+   single int indices: neighbour = cell + STEP[dir].
+   Logical (i, j) lives at padded index (i + 1) * stride + j + 1.
+   --------------------------------------------------------- */
+struct FlatGrid {
+    int n = 0;
+    int m = 0;
+    int stride = 0;                    // m + 2
+    std::vector<std::uint8_t> blocked; // (n + 2) * (m + 2), border = 1
+
+    FlatGrid() = default;
+
+    explicit FlatGrid(const std::vector<std::vector<int>>& grid)
+        : n(static_cast<int>(grid.size())),
+          m(grid.empty() ? 0 : static_cast<int>(grid[0].size())),
+          stride(m + 2),
+          blocked(static_cast<std::size_t>(n + 2) * (m + 2), 1) {
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < m; ++j) {
+                blocked[cell(i, j)] = grid[i][j] == 1;
+            }
+        }
+    }
+
+    int cell(int i, int j) const { return (i + 1) * stride + (j + 1); }
+    Coord coord(int c) const { return Coord{c / stride - 1, c % stride - 1}; }
+    int size() const { return static_cast<int>(blocked.size()); }
+    bool in_bounds(int i, int j) const { return i >= 0 && i < n && j >= 0 && j < m; }
+};
+
+/* ---------------------------------------------------------
+   FLAT LEE RESULT
+   dist per padded cell (-1 = unreached) and a 2-bit parent
+   code per cell (4 cells per byte): the direction index used
+   to ENTER the cell, so parent = cell - step[dir]. 1/32 of
+   the memory of a Coord parent grid.
+   --------------------------------------------------------- */
+struct FlatLeeResult {
+    std::vector<int> dist;
+    std::vector<std::uint8_t> dir;
+
+    int direction(int c) const { return (dir[c >> 2] >> ((c & 3) * 2)) & 3; }
+    void set_direction(int c, int d) { dir[c >> 2] |= static_cast<std::uint8_t>(d << ((c & 3) * 2)); }
+};
+
+/* ---------------------------------------------------------
+   LEE BFS ON A FLAT GRID
+   Same search and same distances as lee_bfs.
+   --------------------------------------------------------- */
+FlatLeeResult lee_bfs(
+    const FlatGrid& grid,
+    int si, int sj,
+    int gi = -1, int gj = -1,
+    bool stop_at_goal = true
+) {
+    const int step[4] = {-grid.stride, 1, grid.stride, -1};   // same order as DI/DJ
+
+    FlatLeeResult result;
+    result.dist.assign(grid.size(), -1);
+    result.dir.assign((grid.size() + 3) / 4, 0);
+
+    if (!grid.in_bounds(si, sj) || grid.blocked[grid.cell(si, sj)]) {
+        return result;
+    }
+
+    const int start = grid.cell(si, sj);
+    const int goal = grid.in_bounds(gi, gj) ? grid.cell(gi, gj) : -1;
+
+    std::vector<int> queue;
+    queue.reserve(1024);
+    queue.push_back(start);
+    result.dist[start] = 0;
+
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const int c = queue[head];
+
+        if (stop_at_goal && c == goal) {
+            break;
+        }
+
+        const int next_dist = result.dist[c] + 1;
+        for (int d = 0; d < 4; ++d) {
+            const int nc = c + step[d];
+            if (grid.blocked[nc] || result.dist[nc] != -1) continue;
+
+            result.dist[nc] = next_dist;
+            result.set_direction(nc, d);
+            queue.push_back(nc);
+        }
+    }
+
+    return result;
+}
+
+/* ---------------------------------------------------------
+   PATH RECONSTRUCTION FROM 2-BIT PARENT CODES
+   Walks back from the goal until the start cell.
+   --------------------------------------------------------- */
+std::vector<Coord> build_path(
+    const FlatGrid& grid,
+    const FlatLeeResult& res,
+    int si, int sj,
+    int gi, int gj
+) {
+    std::vector<Coord> path;
+
+    if (!grid.in_bounds(gi, gj) || !grid.in_bounds(si, sj)) {
+        return path;
+    }
+
+    const int step[4] = {-grid.stride, 1, grid.stride, -1};
+    const int start = grid.cell(si, sj);
+    int c = grid.cell(gi, gj);
+
+    if (res.dist[c] == -1) {
+        return path;
+    }
+
+    path.reserve(res.dist[c] + 1);
+    while (c != start) {
+        path.push_back(grid.coord(c));
+        c -= step[res.direction(c)];
+    }
+    path.push_back(grid.coord(start));
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+/* ---------------------------------------------------------
+   BIT-PARALLEL LEE (unweighted, 4-connected)
+   Free cells, visited cells and the wavefront are packed 64
+   cells per uint64_t word, row by row. One BFS level for a
+   whole word is:
+       next = (cur << 1 | cur >> 1 | up | down) & free & ~visited
+   with carries between neighbouring words of the row, i.e.
+   64 cells per handful of instructions instead of 64 queue
+   pops. Only rows within one step of the current wavefront
+   are touched. Produces the same distance layers as lee_bfs;
+   parents are derived from dist afterwards (the first
+   neighbour in DI/DJ order one layer closer), so the result
+   plugs straight into build_path and yields a shortest path.
+   --------------------------------------------------------- */
+LeeResult lee_bitset(
+    const std::vector<std::vector<int>>& grid,
+    int si, int sj,
+    int gi = -1, int gj = -1,
+    bool stop_at_goal = true
+) {
+    const int n = static_cast<int>(grid.size());
+    const int m = n > 0 ? static_cast<int>(grid[0].size()) : 0;
+    const int W = (m + 63) / 64;
+
+    LeeResult result;
+    result.dist.assign(n, std::vector<int>(m, -1));
+    result.parent.assign(n, std::vector<Coord>(m, Coord{-1, -1}));
+
+    auto in_bounds = [&](int i, int j) -> bool {
+        return (i >= 0 && i < n && j >= 0 && j < m);
+    };
+
+    if (!in_bounds(si, sj) || grid[si][sj] == 1) {
+        return result;
+    }
+
+    std::vector<std::uint64_t> free_bits(static_cast<std::size_t>(n) * W, 0);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < m; ++j) {
+            if (grid[i][j] != 1) {
+                free_bits[i * W + (j >> 6)] |= std::uint64_t{1} << (j & 63);
+            }
+        }
+    }
+
+    std::vector<std::uint64_t> visited(free_bits.size(), 0);
+    std::vector<std::uint64_t> cur(free_bits.size(), 0);
+    std::vector<std::uint64_t> next(free_bits.size(), 0);
+
+    cur[si * W + (sj >> 6)] = std::uint64_t{1} << (sj & 63);
+    visited = cur;
+    result.dist[si][sj] = 0;
+
+    const bool has_goal = in_bounds(gi, gj);
+    int lo = si;   // rows [lo, hi] hold the current wavefront
+    int hi = si;
+
+    for (int level = 1; lo <= hi; ++level) {
+        if (has_goal && stop_at_goal && result.dist[gi][gj] != -1) {
+            break;
+        }
+
+        const int from = std::max(0, lo - 1);
+        const int to = std::min(n - 1, hi + 1);
+        int new_lo = n;
+        int new_hi = -1;
+
+        for (int i = from; i <= to; ++i) {
+            const std::uint64_t* row = &cur[i * W];
+            const std::uint64_t* up = i > 0 ? &cur[(i - 1) * W] : nullptr;
+            const std::uint64_t* down = i + 1 < n ? &cur[(i + 1) * W] : nullptr;
+
+            bool row_active = false;
+            for (int w = 0; w < W; ++w) {
+                std::uint64_t spread = row[w] << 1 | row[w] >> 1;
+                if (w > 0) spread |= row[w - 1] >> 63;        // cell 64w-1 -> 64w
+                if (w + 1 < W) spread |= row[w + 1] << 63;    // cell 64w+64 -> 64w+63
+                if (up) spread |= up[w];
+                if (down) spread |= down[w];
+
+                const std::size_t k = static_cast<std::size_t>(i) * W + w;
+                const std::uint64_t fresh = spread & free_bits[k] & ~visited[k];
+                next[k] = fresh;
+                if (fresh == 0) continue;
+
+                row_active = true;
+                for (std::uint64_t bits = fresh; bits != 0; bits &= bits - 1) {
+                    result.dist[i][w * 64 + std::countr_zero(bits)] = level;
+                }
+            }
+            if (row_active) {
+                new_lo = std::min(new_lo, i);
+                new_hi = std::max(new_hi, i);
+            }
+        }
+
+        // Commit the new layer and clear the old one (only rows we touched)
+        for (int i = from; i <= to; ++i) {
+            for (int w = 0; w < W; ++w) {
+                const std::size_t k = static_cast<std::size_t>(i) * W + w;
+                visited[k] |= next[k];
+                cur[k] = 0;
+            }
+        }
+        cur.swap(next);
+        lo = new_lo;
+        hi = new_hi;
+    }
+
+    // Parents: any neighbour exactly one layer closer to the start
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < m; ++j) {
+            const int d = result.dist[i][j];
+            if (d <= 0) continue;
+            for (int dir = 0; dir < 4; ++dir) {
+                int pi = i + DI[dir];
+                int pj = j + DJ[dir];
+                if (in_bounds(pi, pj) && result.dist[pi][pj] == d - 1) {
+                    result.parent[i][j] = Coord{pi, pj};
+                    break;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/* ---------------------------------------------------------
+   MULTI-SOURCE LEE (grid distance transform)
+   All sources start in the queue at distance 0, so a single
+   O(n * m) BFS gives every cell its distance to the NEAREST
+   source (e.g. "distance to the nearest exit"). Sources may
+   be blocked cells: pass every obstacle to get the distance
+   to the nearest obstacle. Expansion still only enters free
+   cells. Out-of-bounds and repeated sources are ignored.
+
+   label[i][j] = index in `sources` of a nearest source
+   (-1 if unreached); filled only if with_labels is set.
+   parent works with build_path, passing sources[label[gi][gj]]
+   as the start: the path runs from that nearest source.
+   --------------------------------------------------------- */
+struct MultiLeeResult {
+    std::vector<std::vector<int>> dist;            // distance grid
+    std::vector<std::vector<Coord>> parent;        // parent grid, {-1, -1} at sources
+    std::vector<std::vector<int>> label;           // nearest source index (optional)
+};
+
+MultiLeeResult lee_bfs_multi(
+    const std::vector<std::vector<int>>& grid,
+    const std::vector<Coord>& sources,
+    bool with_labels = false
+) {
+    const int n = static_cast<int>(grid.size());
+    const int m = n > 0 ? static_cast<int>(grid[0].size()) : 0;
+
+    MultiLeeResult result;
+    result.dist.assign(n, std::vector<int>(m, -1));
+    result.parent.assign(n, std::vector<Coord>(m, Coord{-1, -1}));
+    if (with_labels) {
+        result.label.assign(n, std::vector<int>(m, -1));
+    }
+
+    auto in_bounds = [&](int i, int j) -> bool {
+        return (i >= 0 && i < n && j >= 0 && j < m);
+    };
+
+    // Plain array queue: every cell is pushed at most once
+    std::vector<Coord> q;
+    q.reserve(static_cast<std::size_t>(n) * m);
+
+    for (int s = 0; s < static_cast<int>(sources.size()); ++s) {
+        auto [i, j] = sources[s];
+        if (!in_bounds(i, j) || result.dist[i][j] != -1) continue;
+
+        result.dist[i][j] = 0;
+        if (with_labels) result.label[i][j] = s;
+        q.emplace_back(i, j);
+    }
+
+    for (std::size_t head = 0; head < q.size(); ++head) {
+        auto [i, j] = q[head];
+
+        for (int dir = 0; dir < 4; ++dir) {
+            int ni = i + DI[dir];
+            int nj = j + DJ[dir];
+
+            if (!in_bounds(ni, nj)) continue;
+            if (grid[ni][nj] == 1) continue;
+            if (result.dist[ni][nj] != -1) continue;
+
+            result.dist[ni][nj] = result.dist[i][j] + 1;
+            result.parent[ni][nj] = Coord{i, j};
+            if (with_labels) result.label[ni][nj] = result.label[i][j];
+            q.emplace_back(ni, nj);
+        }
+    }
+
+    return result;
+}
+
 /* ---------------------------------------------------------
    EXAMPLE MAIN for demonstration
    (remove or adjust for ICPC usage)
@@ -158,5 +616,33 @@ int main() {
         std::cout << "(" << c.first << ", " << c.second << ")\n";
     }
 
+    // Same query on the flat, padded grid with 2-bit parents
+    FlatGrid flat(grid);
+    FlatLeeResult flat_res = lee_bfs(flat, si, sj, gi, gj, true);
+    std::vector<Coord> flat_path = build_path(flat, flat_res, si, sj, gi, gj);
+
+    std::cout << "Flat grid distance: " << flat_res.dist[flat.cell(gi, gj)]
+              << ", same path: " << (flat_path == path ? "yes" : "no") << "\n";
+
+    // Same query with the bit-parallel wavefront
+    LeeResult bit_res = lee_bitset(grid, si, sj, gi, gj, true);
+    std::cout << "Bitset distance: " << bit_res.dist[gi][gj] << ", path length: "
+              << build_path(bit_res.parent, si, sj, gi, gj).size() << "\n";
+
+    // Distance from every cell to the nearest of two exits, with labels
+    std::vector<Coord> exits = {{si, sj}, {gi, gj}};
+    MultiLeeResult multi = lee_bfs_multi(grid, exits, true);
+    std::cout << "Distance to nearest exit (exit index):\n";
+    for (int i = 0; i < static_cast<int>(grid.size()); ++i) {
+        for (int j = 0; j < static_cast<int>(grid[i].size()); ++j) {
+            if (multi.dist[i][j] == -1) {
+                std::cout << "   # ";
+            } else {
+                std::cout << std::setw(3) << multi.dist[i][j] << "(" << multi.label[i][j] << ")";
+            }
+        }
+        std::cout << "\n";
+    }
+
     return 0;
 }
@@ -0,0 +1,284 @@
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+// Compressed Sparse Row (CSR) graph, same layout as CSR Graph/main.cpp.
+// The out-edges of u are target[offset[u] .. offset[u + 1]) with weights in weight[].
+// Three flat arrays instead of one heap allocation per vertex.
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Reusable per-thread scratch for repeated Dijkstra runs on one graph.
+// dist/parent are allocated once; after a run only the entries listed in
+// touched are reset, so a run that stops early costs O(explored), not O(n).
+struct DijkstraScratch {
+    std::vector<long long> dist;
+    std::vector<int> parent;
+    std::vector<int> touched;
+    std::vector<std::pair<long long, int>> heap;   // binary heap, capacity reused
+
+    explicit DijkstraScratch(int n)
+        : dist(n, std::numeric_limits<long long>::max() / 4), parent(n, -1) {}
+
+    void reset()
+    {
+        const long long INF = std::numeric_limits<long long>::max() / 4;
+        for (int v : touched) {
+            dist[v] = INF;
+            parent[v] = -1;
+        }
+        touched.clear();
+        heap.clear();
+    }
+};
+
+// Dijkstra from source into scratch; stops as soon as every vertex with
+// is_target[v] set has been settled (num_targets of them).
+void dijkstra_to_targets(int source,
+                         const CSRGraph<long long> &g,
+                         const std::vector<char> &is_target,
+                         int num_targets,
+                         DijkstraScratch &s)
+{
+    const auto later = std::greater<>();
+    s.reset();
+
+    s.dist[source] = 0;
+    s.touched.push_back(source);
+    s.heap.push_back({0, source});
+
+    int remaining = num_targets;
+    while (!s.heap.empty() && remaining > 0) {
+        std::pop_heap(s.heap.begin(), s.heap.end(), later);
+        auto [d, u] = s.heap.back();
+        s.heap.pop_back();
+
+        // If this is an outdated entry, skip it
+        if (d != s.dist[u]) {
+            continue;
+        }
+        if (is_target[u]) {
+            --remaining;
+        }
+
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            int v = g.target[e];
+            long long nd = d + g.weight[e];
+            if (nd < s.dist[v]) {
+                if (s.parent[v] == -1 && v != source) {
+                    s.touched.push_back(v);
+                }
+                s.dist[v] = nd;
+                s.parent[v] = u;
+                s.heap.push_back({nd, v});
+                std::push_heap(s.heap.begin(), s.heap.end(), later);
+            }
+        }
+    }
+}
+
+// Row-major |sources| x |targets| matrix, at(i, j) = d(sources[i], targets[j])
+struct DistanceTable {
+    int rows = 0;
+    int cols = 0;
+    std::vector<long long> dist;   // INF where unreachable
+
+    long long at(int i, int j) const { return dist[static_cast<std::size_t>(i) * cols + j]; }
+};
+
+// Many-to-many distances: one early-exit Dijkstra per source, sources handed
+// out to a pool of threads through an atomic counter. All threads share the
+// same read-only CSR graph and each reuses one DijkstraScratch, so the
+// O(n) allocation/initialisation is paid once per thread, not per source.
+DistanceTable many_to_many(const CSRGraph<long long> &g,
+                           const std::vector<int> &sources,
+                           const std::vector<int> &targets,
+                           int num_threads = static_cast<int>(std::thread::hardware_concurrency()))
+{
+    const int T = std::max(1, std::min<int>(num_threads, static_cast<int>(sources.size())));
+
+    DistanceTable table;
+    table.rows = static_cast<int>(sources.size());
+    table.cols = static_cast<int>(targets.size());
+    table.dist.resize(static_cast<std::size_t>(table.rows) * table.cols);
+
+    std::vector<char> is_target(g.n, 0);
+    int num_targets = 0;
+    for (int t : targets) {
+        num_targets += !is_target[t];
+        is_target[t] = 1;
+    }
+
+    std::atomic<int> next_source{0};
+
+    auto worker = [&]() {
+        DijkstraScratch scratch(g.n);
+        for (int i = next_source++; i < table.rows; i = next_source++) {
+            dijkstra_to_targets(sources[i], g, is_target, num_targets, scratch);
+            long long *row = table.dist.data() + static_cast<std::size_t>(i) * table.cols;
+            for (int j = 0; j < table.cols; ++j) {
+                row[j] = scratch.dist[targets[j]];
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(T - 1);
+    for (int t = 1; t < T; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &th : pool) {
+        th.join();
+    }
+
+    return table;
+}
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    CSRBuilder<long long> builder(n);
+    builder.reserve(m);
+
+    // Read m directed edges (u, v, w)
+    for (int i = 0; i < m; ++i) {
+        int u, v;
+        long long w;
+        std::cin >> u >> v >> w;
+        builder.add_edge(u, v, w);
+    }
+
+    CSRGraph<long long> g = builder.build();
+
+    int s, t;
+    std::cin >> s;
+    std::vector<int> sources(s);
+    for (int &v : sources) {
+        std::cin >> v;
+    }
+    std::cin >> t;
+    std::vector<int> targets(t);
+    for (int &v : targets) {
+        std::cin >> v;
+    }
+
+    DistanceTable table = many_to_many(g, sources, targets);
+
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+
+    // One row per source, one column per target
+    for (int i = 0; i < table.rows; ++i) {
+        for (int j = 0; j < table.cols; ++j) {
+            if (table.at(i, j) >= INF) {
+                std::cout << "INF";
+            } else {
+                std::cout << table.at(i, j);
+            }
+            std::cout << (j + 1 < table.cols ? ' ' : '\n');
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+Example input (copy-paste when running):
+
+5 6
+0 1 2
+0 2 5
+1 2 1
+1 3 2
+2 3 3
+3 4 1
+2
+0 2
+3
+2 3 4
+
+Meaning:
+- 5 vertices (0..4), 6 directed edges (u, v, w) as in the Dijkstra template
+- sources {0, 2}, targets {2, 3, 4}
+- Output:
+  3 4 5
+  0 3 4
+*/
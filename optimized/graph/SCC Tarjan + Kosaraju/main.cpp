@@ -0,0 +1,375 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+
+// ------------------------------------------------------------
+// Compressed Sparse Row (CSR) graph – see CSR Graph/main.cpp
+// ------------------------------------------------------------
+// The out-edges of u are target[offset[u] .. offset[u + 1]),
+// weights (if any) in weight[]. Flat arrays, no per-vertex
+// allocations, contiguous neighbour scans.
+// ------------------------------------------------------------
+template <typename W>
+struct CSRGraph {
+    int n = 0;
+    std::vector<int> offset;   // size n + 1
+    std::vector<int> target;   // size m
+    std::vector<W> weight;     // size m (empty if unweighted)
+
+    int num_edges() const { return static_cast<int>(target.size()); }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+};
+
+// Collects directed edges in input order, build() groups them by
+// source with a stable counting sort in O(n + m).
+template <typename W>
+struct CSRBuilder {
+    int n;
+    bool weighted;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<W> w;
+
+    explicit CSRBuilder(int n, bool weighted = true) : n(n), weighted(weighted) {}
+
+    void reserve(std::size_t m)
+    {
+        from.reserve(m);
+        to.reserve(m);
+        if (weighted) {
+            w.reserve(m);
+        }
+    }
+
+    void add_edge(int u, int v, W weight = W{})
+    {
+        from.push_back(u);
+        to.push_back(v);
+        if (weighted) {
+            w.push_back(weight);
+        }
+    }
+
+    CSRGraph<W> build() const
+    {
+        const int m = static_cast<int>(from.size());
+
+        CSRGraph<W> g;
+        g.n = n;
+        g.offset.assign(n + 1, 0);
+        g.target.resize(m);
+        if (weighted) {
+            g.weight.resize(m);
+        }
+
+        for (int u : from) {
+            ++g.offset[u + 1];
+        }
+        for (int u = 0; u < n; ++u) {
+            g.offset[u + 1] += g.offset[u];
+        }
+
+        std::vector<int> pos(g.offset.begin(), g.offset.end() - 1);
+        for (int i = 0; i < m; ++i) {
+            int slot = pos[from[i]]++;
+            g.target[slot] = to[i];
+            if (weighted) {
+                g.weight[slot] = w[i];
+            }
+        }
+        return g;
+    }
+};
+
+// Reverse every edge; Kosaraju's second pass runs on the transpose.
+template <typename W>
+CSRGraph<W> transpose(const CSRGraph<W>& g)
+{
+    CSRBuilder<W> builder(g.n, !g.weight.empty());
+    builder.reserve(g.num_edges());
+    for (int u = 0; u < g.n; ++u) {
+        for (int e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            builder.add_edge(g.target[e], u, g.weight.empty() ? W{} : g.weight[e]);
+        }
+    }
+    return builder.build();
+}
+
+CSRGraph<int> to_csr(const std::vector<std::vector<int>>& graph)
+{
+    const int n = static_cast<int>(graph.size());
+    CSRBuilder<int> builder(n, false);
+    for (int u = 0; u < n; ++u) {
+        for (int v : graph[u]) {
+            builder.add_edge(u, v);
+        }
+    }
+    return builder.build();
+}
+
+// ------------------------------------------------------------
+// Strongly connected components
+// ------------------------------------------------------------
+// comp[v] is the component of v. Both algorithms number the
+// components in topological order of the condensation: every
+// edge of dag goes from a lower id to a higher one, so the DAG
+// can be processed in id order without another sort.
+// dag has no self-loops and no repeated edges.
+// ------------------------------------------------------------
+struct SCCResult {
+    int count = 0;
+    std::vector<int> comp;
+    CSRGraph<int> dag;
+};
+
+// Same frame layout as the iterative DFS template: the vertex and
+// the next out-edge to scan, so no recursion depth limit.
+struct SCCFrame {
+    int u;
+    int next_edge;
+};
+
+// Condensed DAG in O(n + m): group edges by source component with
+// the CSR builder, then drop repeats using a last-seen marker.
+CSRGraph<int> condense(const CSRGraph<int>& graph, const std::vector<int>& comp, int count)
+{
+    CSRBuilder<int> builder(count, false);
+    for (int u = 0; u < graph.n; ++u) {
+        for (int e = graph.offset[u]; e < graph.offset[u + 1]; ++e) {
+            int cu = comp[u];
+            int cv = comp[graph.target[e]];
+            if (cu != cv) {
+                builder.add_edge(cu, cv);
+            }
+        }
+    }
+    CSRGraph<int> grouped = builder.build();
+
+    CSRGraph<int> dag;
+    dag.n = count;
+    dag.offset.assign(count + 1, 0);
+    dag.target.reserve(grouped.num_edges());
+
+    std::vector<int> last_seen(count, -1);
+    for (int c = 0; c < count; ++c) {
+        for (int e = grouped.offset[c]; e < grouped.offset[c + 1]; ++e) {
+            int d = grouped.target[e];
+            if (last_seen[d] != c) {
+                last_seen[d] = c;
+                dag.target.push_back(d);
+            }
+        }
+        dag.offset[c + 1] = static_cast<int>(dag.target.size());
+    }
+    return dag;
+}
+
+// ------------------------------------------------------------
+// Tarjan – single pass, iterative
+// ------------------------------------------------------------
+// index[v] is the DFS discovery time, low[v] the smallest index
+// reachable from v's subtree through at most one back edge into
+// the component stack. When low[u] == index[u] on return, u is
+// the root of a component: everything above it on the stack.
+// Components complete sinks first, so ids are flipped at the end
+// to get topological order.
+// ------------------------------------------------------------
+SCCResult tarjan_scc(const CSRGraph<int>& graph)
+{
+    const int n = graph.n;
+
+    SCCResult result;
+    result.comp.assign(n, -1);
+
+    std::vector<int> index(n, -1);
+    std::vector<int> low(n, 0);
+    std::vector<char> on_stack(n, 0);
+    std::vector<int> stack;
+    std::vector<SCCFrame> call;
+    stack.reserve(n);
+    call.reserve(n);
+
+    int timer = 0;
+
+    for (int s = 0; s < n; ++s) {
+        if (index[s] != -1) {
+            continue;
+        }
+
+        index[s] = low[s] = timer++;
+        stack.push_back(s);
+        on_stack[s] = 1;
+        call.push_back({s, graph.offset[s]});
+
+        while (!call.empty()) {
+            SCCFrame& top = call.back();
+            const int u = top.u;
+
+            if (top.next_edge < graph.offset[u + 1]) {
+                int v = graph.target[top.next_edge++];
+                if (index[v] == -1) {
+                    index[v] = low[v] = timer++;
+                    stack.push_back(v);
+                    on_stack[v] = 1;
+                    call.push_back({v, graph.offset[v]});   // `top` is not used after this
+                } else if (on_stack[v]) {
+                    low[u] = std::min(low[u], index[v]);
+                }
+                continue;
+            }
+
+            // All edges of u done: "return" to the parent frame
+            call.pop_back();
+            if (!call.empty()) {
+                int parent = call.back().u;
+                low[parent] = std::min(low[parent], low[u]);
+            }
+
+            if (low[u] == index[u]) {
+                int v;
+                do {
+                    v = stack.back();
+                    stack.pop_back();
+                    on_stack[v] = 0;
+                    result.comp[v] = result.count;
+                } while (v != u);
+                ++result.count;
+            }
+        }
+    }
+
+    for (int v = 0; v < n; ++v) {
+        result.comp[v] = result.count - 1 - result.comp[v];
+    }
+    result.dag = condense(graph, result.comp, result.count);
+    return result;
+}
+
+// ------------------------------------------------------------
+// Kosaraju – two passes, iterative
+// ------------------------------------------------------------
+// Pass 1 records the DFS finishing order on the graph. Pass 2
+// walks the reverse CSR graph from vertices in decreasing finish
+// time; each walk collects exactly one component, and they come
+// out in topological order. Pass a prebuilt transpose to reuse
+// it across calls.
+// ------------------------------------------------------------
+SCCResult kosaraju_scc(const CSRGraph<int>& graph, const CSRGraph<int>& reverse)
+{
+    const int n = graph.n;
+
+    SCCResult result;
+    result.comp.assign(n, -1);
+
+    // Pass 1: post-order over the whole graph
+    std::vector<int> order;
+    order.reserve(n);
+    {
+        std::vector<char> visited(n, 0);
+        std::vector<SCCFrame> call;
+        call.reserve(n);
+
+        for (int s = 0; s < n; ++s) {
+            if (visited[s]) {
+                continue;
+            }
+            visited[s] = 1;
+            call.push_back({s, graph.offset[s]});
+
+            while (!call.empty()) {
+                SCCFrame& top = call.back();
+                if (top.next_edge == graph.offset[top.u + 1]) {
+                    order.push_back(top.u);
+                    call.pop_back();
+                    continue;
+                }
+                int v = graph.target[top.next_edge++];
+                if (!visited[v]) {
+                    visited[v] = 1;
+                    call.push_back({v, graph.offset[v]});
+                }
+            }
+        }
+    }
+
+    // Pass 2: any traversal order works here, a plain stack is enough
+    std::vector<int> stack;
+    stack.reserve(n);
+    for (int k = n - 1; k >= 0; --k) {
+        int s = order[k];
+        if (result.comp[s] != -1) {
+            continue;
+        }
+
+        result.comp[s] = result.count;
+        stack.push_back(s);
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            for (int e = reverse.offset[u]; e < reverse.offset[u + 1]; ++e) {
+                int v = reverse.target[e];
+                if (result.comp[v] == -1) {
+                    result.comp[v] = result.count;
+                    stack.push_back(v);
+                }
+            }
+        }
+        ++result.count;
+    }
+
+    result.dag = condense(graph, result.comp, result.count);
+    return result;
+}
+
+SCCResult kosaraju_scc(const CSRGraph<int>& graph)
+{
+    return kosaraju_scc(graph, transpose(graph));
+}
+
+int main()
+{
+    // 0 -> 1 -> 2 -> 0 form a cycle, 2 -> 3, 3 <-> 4, 4 -> 5
+    std::vector<std::vector<int>> graph = {
+        {1},       // Node 0
+        {2},       // Node 1
+        {0, 3},    // Node 2
+        {4},       // Node 3
+        {3, 5},    // Node 4
+        {}         // Node 5
+    };
+
+    CSRGraph<int> csr = to_csr(graph);
+
+    SCCResult tarjan = tarjan_scc(csr);
+    SCCResult kosaraju = kosaraju_scc(csr);
+
+    std::cout << "Components (Tarjan): " << tarjan.count << "\n";
+    for (int v = 0; v < csr.n; ++v) {
+        std::cout << "Vertex " << v << ": component " << tarjan.comp[v] << "\n";
+    }
+
+    std::cout << "Condensed DAG:\n";
+    for (int c = 0; c < tarjan.dag.n; ++c) {
+        std::cout << c << ":";
+        for (int e = tarjan.dag.offset[c]; e < tarjan.dag.offset[c + 1]; ++e) {
+            std::cout << " " << tarjan.dag.target[e];
+        }
+        std::cout << "\n";
+    }
+
+    // Ids may differ between the two (both are topological orders),
+    // the partition into components may not
+    std::vector<int> to_kosaraju(tarjan.count, -1);
+    bool same = tarjan.count == kosaraju.count;
+    for (int v = 0; v < csr.n && same; ++v) {
+        int& mapped = to_kosaraju[tarjan.comp[v]];
+        if (mapped == -1) {
+            mapped = kosaraju.comp[v];
+        }
+        same = mapped == kosaraju.comp[v];
+    }
+    std::cout << "Kosaraju agrees: " << (same ? "yes" : "no") << "\n";
+
+    return 0;
+}